@@ -0,0 +1,163 @@
+#pragma once
+
+#include <cstddef>
+#include <glm/glm.hpp>
+
+namespace Zerith {
+
+class ChunkManager;
+
+// In-engine microbenchmarks, triggered from the ImGui debug window.
+// Each returns its measurements and also logs them via LOG_INFO.
+namespace Benchmarks {
+
+    struct ChunkStorageResult {
+        double flatGetNs = 0.0;       // Average ns per getBlock on a flat 16^3 array
+        double paletteGetNs = 0.0;    // Average ns per Chunk::getBlock (palette storage)
+        double flatSetNs = 0.0;       // Average ns per setBlock on a flat 16^3 array
+        double paletteSetNs = 0.0;    // Average ns per Chunk::setBlock (palette storage)
+        size_t flatBytes = 0;         // Flat array size for 16^3 blocks
+        size_t paletteBytes = 0;      // Palette + packed index size after the run
+        size_t paletteEntries = 0;
+        int bitsPerBlock = 0;
+    };
+
+    // Compare palette-compressed Chunk access against a flat BlockType array
+    ChunkStorageResult runChunkStorageBenchmark(int iterations = 64);
+
+    struct ChunkCrossingResult {
+        int radius = 0;
+        double cubeScanMs = 0.0;      // Average ms per crossing, (2R+1)^3 scan with per-candidate locks
+        double columnScanMs = 0.0;    // Average ms per crossing, column-based scan
+        double deltaScanMs = 0.0;     // Average ms per crossing, ring delta between old and new center
+        size_t cubeCandidates = 0;    // Positions visited by the cube scan per crossing
+        size_t columnsVisited = 0;    // Columns visited by the column scan per crossing
+        size_t sectionsEntering = 0;  // Sections entering range on the last crossing
+        size_t sectionsLeaving = 0;   // Sections leaving range on the last crossing
+    };
+
+    // Cost of finding chunks to load/unload when the player crosses one chunk boundary.
+    // Uses synthetic fully-loaded worlds, no terrain generation is performed
+    ChunkCrossingResult runChunkCrossingBenchmark(int radius, int verticalRadius = 8, int crossings = 8);
+
+    struct ChunkLookupContentionResult {
+        int readerThreads = 0;
+        double mapLookupNs = 0.0;        // Average ns per lookup, unordered_map behind a shared_mutex
+        double directoryLookupNs = 0.0;  // Average ns per lookup, lock-free ChunkDirectory
+        size_t mapLookups = 0;
+        size_t directoryLookups = 0;
+        size_t mapSwaps = 0;             // Unload/reload pairs the writer completed against the map
+        size_t directorySwaps = 0;       // Unload/reload pairs the writer completed against the directory
+    };
+
+    // Reader threads doing block lookups (as meshing and AO do) while the calling
+    // thread keeps unloading and reloading chunks in frame-sized batches
+    ChunkLookupContentionResult runChunkLookupContentionBenchmark(int readerThreads, int durationMs = 500);
+
+    struct CollisionQueryResult {
+        double perBlockNs = 0.0;     // Average ns per query, one ChunkManager::getBlock per block
+        double regionNs = 0.0;       // Average ns per query, one ChunkManager::copyRegion
+        size_t blocksPerQuery = 0;
+        size_t solidBlocks = 0;      // Colliding blocks found per query
+        bool resultsMatch = true;    // Both paths saw the same blocks
+    };
+
+    // Collision-style block fetch around a point in the loaded world: per-block
+    // lookups (the previous CollisionSystem path) against a single region copy
+    CollisionQueryResult runCollisionQueryBenchmark(const ChunkManager& chunkManager, const glm::vec3& center,
+                                                    const glm::vec3& halfExtent, int iterations = 20000);
+
+    struct FacePackingResult {
+        size_t faces = 0;
+        size_t unpackedBytes = 0;    // sizeof(FaceInstance) per face
+        size_t packedBytes = 0;      // sizeof(PackedFace) per face
+        double packNs = 0.0;         // Average ns per packed face
+        double unpackNs = 0.0;       // Average ns per unpacked face
+        size_t mismatches = 0;       // Faces that did not survive the round trip unchanged
+    };
+
+    // Round-trip random grid-aligned faces (the values meshing produces) through
+    // PackedFace and compare every field, timing both directions
+    FacePackingResult runFacePackingBenchmark(int faceCount = 100000);
+
+    struct FaceVisibilityResult {
+        size_t chunks = 0;
+        double perVoxelUs = 0.0;     // Average us per chunk, FaceVisibilityMaskGenerator::generateMaskPerVoxel
+        double bitwiseUs = 0.0;      // Average us per chunk, occupancy masks plus the bitwise kernel
+        size_t visibleFaces = 0;     // Visible faces summed over all test chunks
+        size_t mismatchedRows = 0;   // X rows where the two generators disagree
+    };
+
+    // Face culling of synthetic chunks (layered terrain, water, glass, slabs,
+    // stairs and random noise, with loaded neighbors) with the per-voxel
+    // generator against the bitwise occupancy-mask kernel
+    FaceVisibilityResult runFaceVisibilityBenchmark(int iterations = 200);
+
+    struct GreedyMeshingResult {
+        size_t chunks = 0;
+        size_t perBlockFaces = 0;    // Faces emitted one per visible block side
+        size_t greedyFaces = 0;      // Faces after greedy merging
+        double perBlockMs = 0.0;     // Average ms per chunk, ChunkMeshGenerator::generateChunkMeshPerBlock
+        double greedyMs = 0.0;       // Average ms per chunk, ChunkMeshGenerator::generateChunkMeshGreedy
+        bool areaMatches = true;     // Both meshes cover the same face area in every render layer
+    };
+
+    // Mesh the loaded chunks around a point with the per-block and the greedy
+    // mesher, comparing face counts, time and covered area
+    GreedyMeshingResult runGreedyMeshingBenchmark(const ChunkManager& chunkManager, const glm::vec3& center,
+                                                  int radius = 2);
+
+    struct MeshingAOResult {
+        size_t chunks = 0;
+        size_t faces = 0;                   // Visible faces AO was computed for
+        int threads = 0;                    // Threads used by the threaded runs
+        double worldAOMs = 0.0;             // Wall ms for all faces, VoxelAO via ChunkManager::getBlock, 1 thread
+        double worldAOThreadedMs = 0.0;     // Same, spread over `threads` threads
+        double snapshotAOMs = 0.0;          // Wall ms for all faces, VoxelAO::calculateRowAO on the snapshot, 1 thread
+        double snapshotAOThreadedMs = 0.0;
+        double meshMs = 0.0;                // Wall ms to mesh all chunks with AO, 1 thread
+        double meshThreadedMs = 0.0;
+        size_t aoMismatches = 0;            // Faces whose AO levels differ between the two (unloaded borders)
+    };
+
+    // Ambient occlusion for the visible faces around a point, from world queries and
+    // from the chunk snapshots meshing now uses, plus full meshing with AO; each on
+    // one thread and on all hardware threads
+    MeshingAOResult runMeshingAOBenchmark(const ChunkManager& chunkManager, const glm::vec3& center, int radius = 2);
+
+    struct IncrementalRemeshResult {
+        size_t chunks = 0;
+        size_t edits = 0;            // Single-block edits remeshed both ways
+        double fullMs = 0.0;         // Average ms per edit: masks, greedy mesh of the whole chunk, packing
+        double incrementalMs = 0.0;  // Average ms per edit: masks, ChunkMeshGenerator::generateChunkMeshIncremental
+        size_t fallbacks = 0;        // Edits whose previous mesh could not be spliced
+        size_t mismatches = 0;       // Edits whose spliced mesh differs from the full remesh
+        size_t interleavedEdits = 0;       // Edit pairs where the second lands while the first is meshing
+        size_t interleavedMismatches = 0;  // Pairs whose follow-up remesh differs from the full remesh
+    };
+
+    // Apply random single-block edits to the loaded chunks around a point and remesh
+    // each one fully and incrementally from the mesh before the edit, checking that
+    // both produce the same faces in the same order. Then pairs of edits whose second
+    // lands before the first's remesh snapshots the chunk, checking that the second's
+    // follow-up remesh catches up with a full remesh
+    IncrementalRemeshResult runIncrementalRemeshBenchmark(const ChunkManager& chunkManager, const glm::vec3& center,
+                                                          int radius = 2, int editsPerChunk = 8);
+
+    struct MeshAllocationResult {
+        size_t chunks = 0;
+        int threads = 0;                   // Threads for the timed runs, at least 8
+        double heapAllocsPerChunk = 0.0;   // Heap allocations for mesh temporaries per chunk, default allocator
+        double arenaAllocsPerChunk = 0.0;  // Same from a warmed-up ScratchArena (its overflows)
+        double heapMs = 0.0;               // Wall ms to mesh and pack every chunk `passes` times, default allocator
+        double arenaMs = 0.0;              // Same with each worker's ScratchArena
+    };
+
+    // Mesh the loaded chunks around a point on many threads, with the mesh temporaries
+    // on the heap and in the per-thread scratch arenas, counting heap allocations
+    MeshAllocationResult runMeshAllocationBenchmark(const ChunkManager& chunkManager, const glm::vec3& center,
+                                                    int radius = 2, int passes = 8);
+
+} // namespace Benchmarks
+
+} // namespace Zerith
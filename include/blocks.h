@@ -35,6 +35,8 @@ enum class RenderLayer {
     TRANSLUCENT  // Transparent blocks (glass, water) - render last with alpha blending
 };
 
+constexpr size_t RENDER_LAYER_COUNT = 3;
+
 // Enhanced block settings that combines rendering and behavior settings
 class BlockSettings {
 private:
@@ -1,21 +1,20 @@
 #pragma once
 
 #include <array>
+#include <memory>
 #include <vector>
 #include <cstdint>
 #include <glm/glm.hpp>
 
 namespace Zerith {
 
-// BlockType is now just an index into the block registry
-using BlockType = uint8_t;
+// BlockType is a global index into the block registry (16-bit so every registered block is placeable)
+using BlockType = uint16_t;
 
 class Chunk {
 public:
     static constexpr int CHUNK_SIZE = 16;
-    static constexpr int EXTENDED_SIZE = 18;  // Store overlapping data for neighbor-free meshing
     static constexpr int CHUNK_VOLUME = CHUNK_SIZE * CHUNK_SIZE * CHUNK_SIZE;
-    static constexpr int EXTENDED_VOLUME = EXTENDED_SIZE * EXTENDED_SIZE * EXTENDED_SIZE;
 
     Chunk(glm::ivec3 chunkPosition = glm::ivec3(0));
     
@@ -26,14 +25,16 @@ public:
     // Disable copy constructor and assignment (chunks are heavy objects)
     Chunk(const Chunk&) = delete;
     Chunk& operator=(const Chunk&) = delete;
+    
+    // Explicit deep copy, used to edit a chunk that lock-free readers may still hold
+    std::unique_ptr<Chunk> clone() const;
 
     // Block access (standard 16x16x16 range: 0-15)
     BlockType getBlock(int x, int y, int z) const;
     void setBlock(int x, int y, int z, BlockType type);
     
-    // Extended block access (18x18x18 range: -1 to 16)
-    BlockType getExtendedBlock(int x, int y, int z) const;
-    void setExtendedBlock(int x, int y, int z, BlockType type);
+    // Copy blocks [xBegin, xEnd) of the row at (y, z) into out; coordinates must be in range
+    void copyRow(int y, int z, int xBegin, int xEnd, BlockType* out) const;
     
     // Get block at world coordinates
     BlockType getBlockWorld(const glm::vec3& worldPos) const;
@@ -49,18 +50,98 @@ public:
     
     // Check if a face should be rendered considering block properties
     bool isFaceVisibleAdvanced(int x, int y, int z, int faceDir) const;
+    
+    // Set every block in the chunk to one type (releases packed storage)
+    void fill(BlockType type);
+    
+    // Compact the palette and shrink index width; collapses to uniform mode
+    // when only one block type remains. Call after bulk writes (e.g. generation)
+    void optimizeStorage();
+    
+    // Uniform (single-value) mode: no palette or index storage is allocated
+    bool isUniform() const { return m_bitsPerIndex == 0; }
+    BlockType getUniformBlock() const { return m_uniformBlock; } // Only meaningful when isUniform()
+    
+    // Content queries, answered from the block counts kept alongside the palette
+    // instead of scanning the blocks. All O(1) or O(palette size)
+    
+    // Check whether the chunk contains only air
+    bool isEmpty() const { return !(m_contentFlags & HAS_SOLID); }
+    
+    // Whether any block is transparent (glass, leaves, fluids)
+    bool hasTransparentBlocks() const { return (m_contentFlags & HAS_TRANSPARENT) != 0; }
+    
+    // Whether every non-air block is an opaque cube whose six faces are full
+    bool hasOnlyFullCubes() const { return !(m_contentFlags & HAS_PARTIAL); }
+    
+    // Number of blocks of a type, and whether there are any
+    int getBlockCount(BlockType type) const;
+    bool containsBlock(BlockType type) const { return getBlockCount(type) > 0; }
+    
+    // Call fn(type, count) for every block type present, in no particular order
+    template<typename Fn>
+    void forEachBlockType(Fn&& fn) const {
+        if (isUniform()) {
+            fn(m_uniformBlock, CHUNK_VOLUME);
+            return;
+        }
+        for (size_t i = 0; i < m_palette.size(); ++i) {
+            if (m_paletteCounts[i] > 0) {
+                fn(m_palette[i], static_cast<int>(m_paletteCounts[i]));
+            }
+        }
+    }
+    
+    // Palette statistics
+    size_t getPaletteSize() const { return isUniform() ? 1 : m_palette.size(); }
+    int getBitsPerBlock() const { return m_bitsPerIndex; }
+    
+    // Approximate heap + inline memory used by this chunk's block storage
+    size_t getMemoryUsage() const;
 
 private:
+    // Summary of the block types present, recomputed when a type appears or disappears
+    enum ContentFlag : uint8_t {
+        HAS_SOLID = 1 << 0,        // Any non-air block
+        HAS_TRANSPARENT = 1 << 1,  // Any transparent block
+        HAS_PARTIAL = 1 << 2       // Any non-air block that isn't an opaque full cube
+    };
+    static uint8_t getContentFlags(BlockType type);
+    void updateContentFlags();
+    
     // Convert 3D coordinates to 1D array index
     constexpr int getIndex(int x, int y, int z) const;
-    constexpr int getExtendedIndex(int x, int y, int z) const;
     
     // Check if coordinates are within chunk bounds
     constexpr bool isInBounds(int x, int y, int z) const;
-    constexpr bool isInExtendedBounds(int x, int y, int z) const;
+    
+    // Packed palette index access
+    uint32_t readPaletteIndex(int index) const;
+    void writePaletteIndex(int index, uint32_t paletteIndex);
+    
+    // Find a block in the palette, adding it (reusing an entry no block references,
+    // or growing the index width) if needed
+    uint32_t findOrAddPaletteEntry(BlockType type);
+    
+    // Drop palette entries no longer referenced by any block
+    void compactPalette();
+    
+    // Repack all indices at a new bit width
+    void resizeIndices(uint8_t newBits);
+    
+    // Leave uniform mode, allocating 1-bit indices that all reference the uniform block
+    void inflate();
 
-    std::array<BlockType, CHUNK_VOLUME> m_blocks;           // Standard 16x16x16 storage
-    std::array<BlockType, EXTENDED_VOLUME> m_extendedBlocks; // Extended 18x18x18 storage
+    // Standard 16x16x16 storage: per-chunk palette of global block IDs plus
+    // bit-packed indices (1/2/4/8 bits, 16 once the palette exceeds 256 entries).
+    // 0 bits means uniform mode: every block is m_uniformBlock and nothing is allocated
+    std::vector<BlockType> m_palette;
+    std::vector<uint16_t> m_paletteCounts;  // Blocks referencing each palette entry
+    std::vector<uint64_t> m_packedIndices;
+    uint8_t m_bitsPerIndex = 0;
+    BlockType m_uniformBlock = 0;
+    uint8_t m_contentFlags = 0;
+    
     glm::ivec3 m_chunkPosition; // Position of chunk in chunk coordinates
 };
 
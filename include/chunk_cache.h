@@ -0,0 +1,87 @@
+#pragma once
+
+#include "chunk.h"
+#include "face_arena.h"
+#include <list>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtx/hash.hpp>
+
+namespace Zerith {
+
+/**
+ * Bounded LRU of recently unloaded chunk sections and their meshes.
+ *
+ * Sections that leave range are parked here instead of being destroyed, so
+ * walking back restores them (with any setBlock edits) without terrain
+ * generation or meshing. Chunks stay in their palette storage and meshes are
+ * the same shared snapshots the face arena held, so parking copies nothing.
+ * Chunks may still be read by lock-free lookups that started before the
+ * unload, so evicted chunks are retired through the EpochReclaimer rather
+ * than deleted.
+ */
+class ChunkCache {
+public:
+    struct Entry {
+        std::unique_ptr<Chunk> chunk;
+        ChunkMeshSnapshot mesh;    // Null if the section was unloaded before its first mesh or mid-remesh
+        uint32_t neighborMask = 0; // Neighbors loaded when the section was unloaded, bit per offset in the 3x3x3 block
+    };
+
+    explicit ChunkCache(size_t capacity = DEFAULT_CAPACITY);
+    ~ChunkCache();
+
+    ChunkCache(const ChunkCache&) = delete;
+    ChunkCache& operator=(const ChunkCache&) = delete;
+
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    // Park an unloaded section as the most recently used entry, evicting the oldest if full
+    void put(const glm::ivec3& chunkPos, Entry entry);
+
+    // Remove and return a cached section, counting a hit or miss
+    std::optional<Entry> take(const glm::ivec3& chunkPos);
+
+    bool contains(const glm::ivec3& chunkPos) const { return m_index.contains(chunkPos); }
+
+    // Discard a cached section's mesh but keep its chunk, returns false if it is not cached
+    bool dropMesh(const glm::ivec3& chunkPos);
+
+    // Drop every entry
+    void clear();
+
+    // Maximum number of sections kept; shrinking evicts immediately
+    void setCapacity(size_t capacity);
+    size_t getCapacity() const { return m_capacity; }
+
+    size_t size() const { return m_index.size(); }
+    size_t getMemoryUsage() const { return m_memoryBytes; }
+    size_t getHits() const { return m_hits; }
+    size_t getMisses() const { return m_misses; }
+    size_t getEvictions() const { return m_evictions; }
+
+private:
+    using EntryList = std::list<std::pair<glm::ivec3, Entry>>;
+
+    static size_t getEntryMemoryUsage(const Entry& entry);
+
+    // Remove the least recently used entry
+    void evictOldest();
+
+    // Free an entry's chunk once no reader can hold it
+    static void retireEntry(Entry& entry);
+
+    EntryList m_entries;  // Most recently unloaded first
+    std::unordered_map<glm::ivec3, EntryList::iterator> m_index;
+    size_t m_capacity;
+    size_t m_memoryBytes = 0;
+    size_t m_hits = 0;
+    size_t m_misses = 0;
+    size_t m_evictions = 0;
+};
+
+} // namespace Zerith
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "chunk.h"
+#include "world_constants.h"
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/gtx/hash.hpp>
+
+namespace Zerith {
+
+// Vertical section range in chunk coordinates (-4..19 for the 384-block world)
+constexpr int MIN_SECTION_Y = WORLD_MIN_Y / Chunk::CHUNK_SIZE;
+constexpr int MAX_SECTION_Y = MIN_SECTION_Y + CHUNKS_Y - 1;
+
+static_assert(CHUNKS_Y <= 32, "Section masks are stored in 32 bits");
+
+// Per-column record of which vertical sections are loaded or being generated.
+// Bit i corresponds to chunk Y = MIN_SECTION_Y + i
+struct ChunkColumn {
+    uint32_t presentSections = 0;
+    uint32_t loadingSections = 0;
+
+    bool isEmpty() const { return presentSections == 0 && loadingSections == 0; }
+
+    static constexpr bool isValidSection(int chunkY) {
+        return chunkY >= MIN_SECTION_Y && chunkY <= MAX_SECTION_Y;
+    }
+
+    static constexpr uint32_t sectionBit(int chunkY) {
+        return uint32_t(1) << (chunkY - MIN_SECTION_Y);
+    }
+
+    // Mask of sections in [minChunkY, maxChunkY], clamped to the world
+    static uint32_t sectionRangeMask(int minChunkY, int maxChunkY);
+};
+
+// Column records keyed by chunk (x, z)
+using ChunkColumnMap = std::unordered_map<glm::ivec2, ChunkColumn>;
+
+// Cylindrical load volume: horizontal radius in columns, vertical radius in sections
+struct ChunkLoadVolume {
+    int horizontalRadius = 8;
+    int verticalRadius = 8;
+
+    bool operator==(const ChunkLoadVolume& other) const = default;
+
+    bool containsColumn(const glm::ivec3& center, const glm::ivec2& columnPos) const {
+        int dx = columnPos.x - center.x;
+        int dz = columnPos.y - center.z;
+        return dx * dx + dz * dz <= horizontalRadius * horizontalRadius;
+    }
+
+    bool contains(const glm::ivec3& center, const glm::ivec3& chunkPos) const {
+        return ChunkColumn::isValidSection(chunkPos.y) &&
+               std::abs(chunkPos.y - center.y) <= verticalRadius &&
+               containsColumn(center, glm::ivec2(chunkPos.x, chunkPos.z));
+    }
+
+    // Sections wanted in every column inside the horizontal radius
+    uint32_t getSectionMask(const glm::ivec3& center) const {
+        return ChunkColumn::sectionRangeMask(center.y - verticalRadius, center.y + verticalRadius);
+    }
+
+    // Sections that should be loaded but are neither present nor loading.
+    // Walks only the columns inside the cylinder: O(columns), no locking
+    void collectMissingSections(const glm::ivec3& center, const ChunkColumnMap& columns,
+                                std::vector<glm::ivec3>& outMissing) const;
+
+    // Present sections that fall outside the volume. Walks only known columns
+    void collectLeavingSections(const glm::ivec3& center, const ChunkColumnMap& columns,
+                                std::vector<glm::ivec3>& outLeaving) const;
+
+    // Sections entering and leaving the volume when its center moves from
+    // oldCenter to newCenter. Works row by row on the difference of the two
+    // cylinders, so only the ring that actually changed is visited (plus every
+    // column of the overlap when the vertical range shifts)
+    void collectDelta(const glm::ivec3& oldCenter, const glm::ivec3& newCenter,
+                      const ChunkColumnMap& columns,
+                      std::vector<glm::ivec3>& outEntering,
+                      std::vector<glm::ivec3>& outLeaving) const;
+
+private:
+    // Columns with |dx| <= half width are inside the cylinder's row at dz, -1 if the row is empty
+    int getRowHalfWidth(int dz) const;
+};
+
+} // namespace Zerith
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "chunk.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include <glm/glm.hpp>
+
+namespace Zerith {
+
+// Flat open-addressing table from chunk position to chunk.
+//
+// Lookups are lock-free: find() may run on any thread while holding an
+// EpochReclaimer::Guard, and the returned chunk stays valid until the guard is
+// released. Chunks handed to readers are never modified in place; writers
+// publish a new chunk with insert() and the old one is retired. Mutations
+// (insert/erase/forEach) must be serialized by the caller.
+class ChunkDirectory {
+public:
+    ChunkDirectory();
+    ~ChunkDirectory();
+
+    ChunkDirectory(const ChunkDirectory&) = delete;
+    ChunkDirectory& operator=(const ChunkDirectory&) = delete;
+
+    // Lock-free lookup, nullptr if the chunk is not loaded
+    Chunk* find(const glm::ivec3& chunkPos) const;
+    bool contains(const glm::ivec3& chunkPos) const { return find(chunkPos) != nullptr; }
+
+    // Publish a chunk at its own position, retiring any chunk it replaces
+    Chunk* insert(std::unique_ptr<Chunk> chunk);
+
+    // Unlink and retire a chunk, returns false if it was not loaded
+    bool erase(const glm::ivec3& chunkPos);
+
+    // Unlink a chunk and hand it to the caller, nullptr if it was not loaded.
+    // Readers may still hold it, so it must be re-inserted or retired, never deleted
+    std::unique_ptr<Chunk> extract(const glm::ivec3& chunkPos);
+
+    // Retire every chunk
+    void clear();
+
+    size_t size() const { return m_size; }
+    size_t getCapacity() const { return m_table.load(std::memory_order_relaxed)->mask + 1; }
+
+    // Visit every chunk (writer side)
+    template<typename Func>
+    void forEach(Func&& func) const {
+        const Table* table = m_table.load(std::memory_order_acquire);
+        for (size_t i = 0; i <= table->mask; ++i) {
+            Chunk* chunk = table->slots[i].chunk.load(std::memory_order_acquire);
+            if (chunk) {
+                func(chunk->getChunkPosition(), *chunk);
+            }
+        }
+    }
+
+private:
+    static constexpr uint64_t EMPTY_KEY = ~uint64_t(0);
+    static constexpr uint64_t TOMBSTONE_KEY = ~uint64_t(0) - 1;
+    static constexpr size_t MIN_CAPACITY = 1024;
+
+    struct Slot {
+        std::atomic<uint64_t> key{EMPTY_KEY};
+        std::atomic<Chunk*> chunk{nullptr};
+    };
+
+    struct Table {
+        explicit Table(size_t capacity) : mask(capacity - 1), slots(new Slot[capacity]) {}
+        size_t mask;
+        std::unique_ptr<Slot[]> slots;
+    };
+
+    // 28 bits for x and z, 7 for y; the high bit stays clear so keys never hit the sentinels.
+    // Positions can share a key, so a matching key is confirmed against the chunk itself
+    static uint64_t packKey(const glm::ivec3& chunkPos);
+    static size_t hashKey(uint64_t key);
+
+    // Writer side: whether a live slot holds the chunk at chunkPos
+    static bool isSlotFor(const Slot& slot, const glm::ivec3& chunkPos);
+
+    // Rebuild into a table sized for the live chunks, dropping tombstones
+    void rehash(size_t capacity);
+
+    std::atomic<Table*> m_table;
+    size_t m_size = 0;        // Live chunks
+    size_t m_occupied = 0;    // Live chunks plus tombstones
+};
+
+} // namespace Zerith
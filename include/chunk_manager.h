@@ -1,6 +1,12 @@
 #pragma once
 
 #include "chunk.h"
+#include "chunk_neighborhood.h"
+#include "chunk_column.h"
+#include "chunk_directory.h"
+#include "chunk_cache.h"
+#include "face_arena.h"
+#include "extended_chunk_data.h"
 #include "chunk_mesh_generator.h"
 #include "terrain_generator.h"
 #include "blockbench_instance_generator.h"
@@ -8,6 +14,7 @@
 #include "chunk_octree.h"
 #include "thread_pool.h"
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
 #include <vector>
 #include <thread>
@@ -18,6 +25,11 @@
 #include <atomic>
 #include <future>
 #include <functional>
+#include <optional>
+#include <chrono>
+#include <span>
+#include <array>
+#include <cmath>
 
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/glm.hpp>
@@ -45,26 +57,50 @@ struct MeshGenerationRequest {
 
 struct CompletedMesh {
     glm::ivec3 chunkPos;
-    std::vector<BlockbenchInstanceGenerator::FaceInstance> faces;
+    ChunkMesh mesh;
+    Task::TaskId taskId = 0;  // Task that produced the mesh, 0 if untracked
+    bool hashChecked = false; // The input hash was compared against the integrated mesh's
+    bool unchanged = false;   // ...and matched: keep the integrated mesh, this one is empty
+    bool incremental = false; // Spliced from the integrated mesh, rebuilding only dirty slices
+    std::optional<std::chrono::steady_clock::time_point> editTime; // Oldest block edit the mesh covers
+};
+
+// A chunk waiting for flushDirtyChunks
+struct DirtyChunk {
+    ChunkSliceMask slices{};
+    std::optional<std::chrono::steady_clock::time_point> editTime; // Oldest block edit not yet meshed
+    
+    void merge(const ChunkSliceMask& moreSlices,
+               const std::optional<std::chrono::steady_clock::time_point>& moreEditTime) {
+        for (size_t axis = 0; axis < slices.size(); ++axis) {
+            slices[axis] |= moreSlices[axis];
+        }
+        if (moreEditTime && (!editTime || *moreEditTime < *editTime)) {
+            editTime = moreEditTime;
+        }
+    }
 };
 
 struct ChunkData {
     std::unique_ptr<Chunk> chunk;
     std::vector<BlockbenchInstanceGenerator::FaceInstance> faces;
     std::atomic<bool> ready{false};
+    Task::TaskId taskId = 0;  // Load task that generated the chunk
     
     // Move constructor and assignment
     ChunkData() = default;
     ChunkData(ChunkData&& other) noexcept 
         : chunk(std::move(other.chunk)), 
           faces(std::move(other.faces)), 
-          ready(other.ready.load()) {}
+          ready(other.ready.load()),
+          taskId(other.taskId) {}
     
     ChunkData& operator=(ChunkData&& other) noexcept {
         if (this != &other) {
             chunk = std::move(other.chunk);
             faces = std::move(other.faces);
             ready = other.ready.load();
+            taskId = other.taskId;
         }
         return *this;
     }
@@ -74,6 +110,74 @@ struct ChunkData {
     ChunkData& operator=(const ChunkData&) = delete;
 };
 
+struct ChunkLatencyStats {
+    double avgInViewMs = 0.0;      // Average time from entering range to first mesh, chunks in view
+    double avgOutOfViewMs = 0.0;   // Same for chunks outside the view cone when they became visible
+    size_t inViewSamples = 0;
+    size_t outOfViewSamples = 0;
+};
+
+// Power-of-two histogram of edit-to-visible times: bucket i counts samples under
+// 2^i ms, the last bucket everything slower
+struct EditLatencyHistogram {
+    static constexpr size_t BUCKET_COUNT = 10; // < 1 ms, < 2 ms ... < 256 ms, >= 256 ms
+    std::array<size_t, BUCKET_COUNT> buckets{};
+    size_t samples = 0;
+    double avgMs = 0.0;
+    double maxMs = 0.0;
+    
+    void record(double ms) {
+        const size_t bucket = ms < 1.0 ? 0 : static_cast<size_t>(std::log2(ms)) + 1;
+        buckets[std::min(bucket, BUCKET_COUNT - 1)]++;
+        samples++;
+        avgMs += (ms - avgMs) / samples;
+        maxMs = std::max(maxMs, ms);
+    }
+};
+
+// Time from a block edit to the integration of the first mesh that includes it,
+// split by whether sections were streaming in at the time
+struct EditLatencyStats {
+    EditLatencyHistogram streaming; // Loads pending or in flight
+    EditLatencyHistogram idle;
+};
+
+struct ChunkTaskStats {
+    size_t cancelledLoads = 0;    // Load tasks cancelled because their section left range
+    size_t cancelledMeshes = 0;   // Mesh tasks cancelled for the same reason
+    size_t wastedGenerations = 0; // Sections generated and then thrown away
+    size_t wastedMeshes = 0;      // Meshes built and then thrown away
+    size_t meshesBuilt = 0;       // Meshes built and integrated, remeshes included
+    size_t chunksMeshed = 0;      // Sections that received their first mesh
+    size_t meshHashChecks = 0;    // Remeshes whose input hash was compared against the current mesh
+    size_t meshHashHits = 0;      // ...of which the input was unchanged and the mesh kept
+    size_t remeshRequests = 0;    // regenerateChunkMesh calls (block edits, sync loads)
+    size_t remeshesFlushed = 0;   // ...left after coalescing them per frame, queued as mesh tasks
+    size_t incrementalRemeshes = 0; // Remeshes that rebuilt only the slices around edits
+};
+
+// Meshing lifecycle of a loaded section. A section is only meshed once the
+// neighbors its mesh reads are present, instead of once per arriving neighbor
+enum class ChunkState : uint8_t {
+    Generated,       // Blocks loaded, waiting for neighbors (or for the mesh volume to reach it)
+    NeighborsReady,  // Neighbors present, first mesh queued
+    Meshed           // First mesh integrated; later meshes are remeshes
+};
+
+struct ChunkStorageStats {
+    size_t memoryBytes = 0;      // Block storage across all loaded chunks
+    size_t uniformChunks = 0;    // Chunks held in single-value mode
+    size_t skippedMeshes = 0;    // Mesh jobs skipped because the chunk and its neighbors are uniform
+};
+
+// Destination layout for ChunkManager::copyRegion: block (x, y, z) relative to the
+// region minimum lands at data[x + y * rowStride + z * sliceStride]
+struct BlockRegionView {
+    BlockType* data = nullptr;
+    size_t rowStride = 0;    // Elements between consecutive y
+    size_t sliceStride = 0;  // Elements between consecutive z
+};
+
 class ChunkManager {
 public:
     ChunkManager();
@@ -85,27 +189,42 @@ public:
         m_meshGenCallback = meshGenCallback;
     }
     
-    // Update which chunks are loaded based on player position
-    void updateLoadedChunks(const glm::vec3& playerPosition);
+    // Per-frame update, called every frame whether or not the player moved: integrates
+    // finished loads and meshes, remeshes edited chunks and applies a frame's budget of
+    // pending loads and unloads. Which chunks should be loaded is only recomputed when
+    // the player crosses into another chunk. The camera direction and velocity steer
+    // load and mesh priorities towards what the player is about to see
+    void updateLoadedChunks(const glm::vec3& playerPosition,
+                            const glm::vec3& cameraFront = glm::vec3(0.0f),
+                            const glm::vec3& velocity = glm::vec3(0.0f));
     
-    // Get all face instances for rendering (returns reference to avoid copying)
-    const std::vector<BlockbenchInstanceGenerator::FaceInstance>& getAllFaceInstances() const { return m_allFaceInstances; }
+    // Face instances of all chunk meshes, one slab per chunk (see FaceArena)
+    const FaceArena& getFaceArena() const { return m_faceArena; }
     
-    // Get face instances for rendering when changed (avoids unnecessary operations)
-    std::vector<BlockbenchInstanceGenerator::FaceInstance> getFaceInstancesWhenChanged() { 
+    // Arena for the renderer to upload its dirty ranges from; clears the changed flag
+    FaceArena& acquireFaceArenaChanges() {
         m_needsRebuild = false;
-        return m_allFaceInstances; // Copy, but only when actually changed
+        return m_faceArena;
     }
     
-    // Check if face instances have been updated since last move
+    // Check if face instances or draw data changed since the last acquireFaceArenaChanges()
     bool hasFaceInstancesChanged() const { return m_needsRebuild; }
     
-    // Get a specific chunk (returns nullptr if not loaded)
+    // Get a specific chunk (returns nullptr if not loaded). The pointer stays valid
+    // on the main thread until the chunk is unloaded or edited
     Chunk* getChunk(const glm::ivec3& chunkPos);
     
     // Get block at world position
     BlockType getBlock(const glm::vec3& worldPos) const;
     
+    // Copy the blocks in [min, max] (inclusive world block coordinates) into a tightly
+    // packed buffer, x fastest then y then z. Each touched chunk is resolved once and
+    // unloaded chunks read as air. Returns false if the buffer is too small
+    bool copyRegion(const glm::ivec3& min, const glm::ivec3& max, std::span<BlockType> out) const;
+    
+    // Same, into a caller-laid-out buffer (e.g. a padded one)
+    void copyRegion(const glm::ivec3& min, const glm::ivec3& max, const BlockRegionView& out) const;
+    
     // Set block at world position
     void setBlock(const glm::vec3& worldPos, BlockType type);
     
@@ -115,19 +234,40 @@ public:
     // Get chunks along a ray using octree for fast raycasting
     std::vector<Chunk*> getChunksAlongRay(const glm::vec3& origin, const glm::vec3& direction, float maxDistance = std::numeric_limits<float>::max()) const;
     
-    // Get render distance in chunks
+    // Get render distance in chunks (horizontal radius of the load cylinder)
     int getRenderDistance() const { return m_renderDistance; }
     void setRenderDistance(int distance) { 
         m_renderDistance = std::min(std::max(distance, 1), 32); // Clamp between 1 and 32
     }
     
+    // Vertical render distance in sections above/below the player
+    int getVerticalRenderDistance() const { return m_verticalRenderDistance; }
+    void setVerticalRenderDistance(int distance) {
+        m_verticalRenderDistance = std::min(std::max(distance, 1), CHUNKS_Y); // Clamp to world height
+    }
+    
     // Get statistics
     size_t getLoadedChunkCount() const { return m_chunks.size(); }
+    size_t getLoadedColumnCount() const { return m_columns.size(); }
+    size_t getPendingLoadCount() const { return m_pendingLoads.size(); }
+    size_t getPendingUnloadCount() const { return m_pendingUnloads.size(); }
     size_t getTotalFaceCount() const;
+    ChunkStorageStats getChunkStorageStats() const;
+    const ChunkLatencyStats& getChunkLatencyStats() const { return m_latencyStats; }
+    const EditLatencyStats& getEditLatencyStats() const { return m_editLatencyStats; }
+    size_t getReprioritizationCount() const { return m_reprioritizations; }
+    const ChunkTaskStats& getChunkTaskStats() const { return m_taskStats; }
+    
+    // Recently unloaded sections kept for cheap reloading
+    const ChunkCache& getChunkCache() const { return m_chunkCache; }
+    void setChunkCacheCapacity(size_t capacity) { m_chunkCache.setCapacity(capacity); }
     
     // Get mesh generator for texture array access
     const ChunkMeshGenerator* getMeshGenerator() const { return m_meshGenerator.get(); }
     
+    // Snapshot 18x18x18 block data (chunk + neighbor border) for meshing
+    std::optional<ExtendedChunkData> createExtendedChunkData(const glm::ivec3& chunkPos) const;
+    
     // Process completed chunk loading tasks
     void processCompletedChunks();
     
@@ -138,7 +278,7 @@ private:
     // Convert world position to chunk position
     glm::ivec3 worldToChunkPos(const glm::vec3& worldPos) const;
     
-    // Load a chunk at the given chunk position (synchronous)
+    // Load a chunk at the given chunk position (synchronous); its mesh is queued like a streamed one
     void loadChunk(const glm::ivec3& chunkPos);
     
     // Load a chunk asynchronously
@@ -150,31 +290,104 @@ private:
     // Generate terrain for a chunk (placeholder for now)
     void generateTerrain(Chunk& chunk);
     
-    // Check if a chunk position is within render distance
-    bool isChunkInRange(const glm::ivec3& chunkPos, const glm::ivec3& centerChunkPos) const;
+    // Load/mesh priority for a chunk from the current view: distance to the position
+    // predicted from the velocity, weighted up for chunks outside the view cone.
+    // Same scale as before (1000 - effective distance squared), higher is sooner
+    int computeChunkPriority(const glm::ivec3& chunkPos) const;
+    bool isChunkInView(const glm::ivec3& chunkPos) const;
+    
+    // Re-score queued load and mesh tasks and the pending load list for the current view
+    void reprioritizeQueuedTasks();
+    
+    // Cancel tracked load and mesh tasks whose section is outside the current volume
+    void cancelOutOfRangeTasks();
+    
+    // Record entering-range to first-mesh latency for a chunk
+    void recordTimeToVisible(const glm::ivec3& chunkPos);
+    
+    // Sections meshed and drawn around the player (the render distance)
+    ChunkLoadVolume getMeshVolume() const;
+    
+    // Current cylindrical load volume: the mesh volume plus GENERATION_RING, so
+    // sections at the edge of the mesh volume have their neighbors generated
+    ChunkLoadVolume getLoadVolume() const;
+    
+    // Load volume grown by the unload hysteresis: sections are only unloaded
+    // (and their in-flight work cancelled) once they leave this one
+    ChunkLoadVolume getUnloadVolume() const;
+    
+    // Bring a section back from the unload cache, returns false on a miss
+    bool restoreCachedChunk(const glm::ivec3& chunkPos);
+    
+    // Loaded sections among the 26 around chunkPos, bit per offset in the 3x3x3 block.
+    // Meshes read all of them (faces for culling, edges and corners for AO)
+    uint32_t getLoadedNeighborMask(const glm::ivec3& chunkPos) const;
+    
+    // Freeze a freshly built mesh into an immutable snapshot with the next generation number
+    ChunkMeshSnapshot makeMeshSnapshot(ChunkMesh&& mesh);
+    
+    // Drain the pending load/unload lists within the per-frame budget, returns true if chunks were unloaded
+    bool processPendingChunkUpdates();
+    
+    // Column section bookkeeping (main thread only)
+    void setSectionPresent(const glm::ivec3& chunkPos, bool present);
+    void setSectionLoading(const glm::ivec3& chunkPos, bool loading);
+    
+    // Mark slices of a chunk's mesh out of date (all of them unless only blocks near an
+    // edit changed); requests are coalesced and queued by flushDirtyChunks once per frame.
+    // editTime is set for the player's block edits
+    void regenerateChunkMesh(const glm::ivec3& chunkPos, const ChunkSliceMask& slices = ALL_CHUNK_SLICES,
+                             std::optional<std::chrono::steady_clock::time_point> editTime = std::nullopt);
     
-    // Regenerate mesh for a chunk (e.g., when neighbors change)
-    void regenerateChunkMesh(const glm::ivec3& chunkPos);
+    // Queue one remesh per dirty chunk. Chunks with a mesh task in flight stay dirty
+    // until it lands, since the task may have snapshotted them before the edit
+    void flushDirtyChunks();
+    
+    // Edit-to-visible sample for a mesh covering an edit made at editTime
+    void recordEditLatency(std::chrono::steady_clock::time_point editTime);
+    
+    // Whether every neighbor the mesher reads is loaded. Neighbors outside the world
+    // or the load volume won't arrive, so they don't hold the section back
+    bool hasNeighborsForMeshing(const glm::ivec3& chunkPos) const;
+    
+    // Queue the first mesh of a Generated section once it is inside the mesh
+    // volume and its neighbors are loaded
+    void scheduleFirstMesh(const glm::ivec3& chunkPos);
+    
+    // A section was added to m_chunks: schedule it and the Generated neighbors it
+    // completes, and collect meshed neighbors that were built without it
+    void onSectionAdded(const glm::ivec3& chunkPos, std::vector<glm::ivec3>& neighborsToRemesh);
     
     
     // Background chunk loading function
     std::unique_ptr<ChunkData> loadChunkBackground(const glm::ivec3& chunkPos);
     
     // Background mesh generation function
-    std::vector<BlockbenchInstanceGenerator::FaceInstance> generateMeshForChunk(const glm::ivec3& chunkPos, Chunk* chunk);
-    
-    // Queue mesh generation for a chunk
-    void queueMeshGeneration(const glm::ivec3& chunkPos, int priority);
-    
-    // Create 18x18x18 block data by sampling from loaded chunks
-    std::array<BlockType, 18*18*18> createExtendedBlockData(const glm::ivec3& chunkPos);
+    // With a previous mesh, keeps it when the meshing input hashes the same and splices
+    // it when only dirtySlices changed; otherwise meshes the whole chunk
+    CompletedMesh generateMeshForChunk(const glm::ivec3& chunkPos, const ChunkMeshSnapshot& previous,
+                                       const ChunkSliceMask& dirtySlices);
+    
+    // Queue mesh generation for a chunk. Requests for a chunk with a task in flight
+    // are merged into its dirty slices and queued after the task lands. Remeshes for
+    // block edits (with an editTime) go to the thread pool's interactive lane
+    void queueMeshGeneration(const glm::ivec3& chunkPos, int priority,
+                             const ChunkSliceMask& dirtySlices = ALL_CHUNK_SLICES,
+                             std::optional<std::chrono::steady_clock::time_point> editTime = std::nullopt);
+    
+    // Check if a uniform chunk produces no faces given its neighbors (caller must hold m_chunksMutex)
+    bool canSkipMeshing(const glm::ivec3& chunkPos) const;
+    
+    // Build a view over a chunk and its loaded neighbors (caller must hold m_chunksMutex or an epoch guard)
+    ChunkNeighborhood getChunkNeighborhood(const Chunk& chunk) const;
 
 private:
-    // Chunk storage - key is chunk position
-    std::unordered_map<glm::ivec3, std::unique_ptr<Chunk>> m_chunks;
+    // Chunk storage - lock-free lookups by chunk position, mutated on the main thread only
+    ChunkDirectory m_chunks;
     
-    // Face instances for each chunk
-    std::unordered_map<glm::ivec3, std::vector<BlockbenchInstanceGenerator::FaceInstance>> m_chunkMeshes;
+    // Face instances for each chunk, in persistent per-chunk slabs
+    FaceArena m_faceArena;
+    uint64_t m_meshGeneration = 0;
     
     // Mesh generator
     std::unique_ptr<ChunkMeshGenerator> m_meshGenerator;
@@ -182,31 +395,77 @@ private:
     // Terrain generator
     std::unique_ptr<TerrainGenerator> m_terrainGenerator;
     
-    // Render distance in chunks
+    // Render distance in chunks (horizontal) and sections (vertical)
     int m_renderDistance = 8;
+    int m_verticalRenderDistance = 8;
+    
+    // Which sections of each column are loaded or loading (main thread only)
+    ChunkColumnMap m_columns;
     
-    // Last player chunk position to detect when to update loaded chunks
+    // Last player chunk position and load volume to detect when to update loaded chunks
     glm::ivec3 m_lastPlayerChunkPos = glm::ivec3(INT_MAX);
+    ChunkLoadVolume m_lastLoadVolume{0, 0};
+    
+    // View used for priorities, and the view at the last re-prioritisation
+    glm::vec3 m_viewPosition = glm::vec3(0.0f);
+    glm::vec3 m_viewFront = glm::vec3(0.0f);
+    glm::vec3 m_viewVelocity = glm::vec3(0.0f);
+    glm::vec3 m_prioritizedFront = glm::vec3(0.0f);
+    glm::ivec3 m_prioritizedChunkPos = glm::ivec3(INT_MAX);
+    size_t m_reprioritizations = 0;
+    static constexpr float PRIORITY_LOOKAHEAD_SECONDS = 0.75f;
+    static constexpr float VIEW_CONE_COS = 0.5f;          // 60 degree half-angle
+    static constexpr float OUT_OF_VIEW_WEIGHT = 1.0f;     // Distance multiplier growth per unit of cosine outside the cone
+    static constexpr float REPRIORITIZE_TURN_COS = 0.94f; // Re-score after turning ~20 degrees
+    static constexpr int NEIGHBOR_REMESH_PENALTY = 300;
+    
+    // When each section entered range, for time-to-visible (main thread only)
+    std::unordered_map<glm::ivec3, std::chrono::steady_clock::time_point> m_loadRequestTimes;
+    ChunkLatencyStats m_latencyStats;
+    EditLatencyStats m_editLatencyStats;
+    
+    // Sections waiting to be loaded or unloaded (main thread only). Loads are
+    // sorted farthest first so the nearest are popped from the back
+    std::vector<glm::ivec3> m_pendingLoads;
+    std::vector<glm::ivec3> m_pendingUnloads;
+    static constexpr int MAX_LOADS_PER_FRAME = 256;
+    static constexpr int MAX_UNLOADS_PER_FRAME = 256;
+    static constexpr int UNLOAD_HYSTERESIS = 2;  // Sections beyond the load radius before unloading
+    static constexpr int GENERATION_RING = 1;    // Sections generated beyond the mesh radius
+    
+    // Meshing state of every loaded section, and the Generated ones re-checked when
+    // the mesh volume moves (main thread only)
+    std::unordered_map<glm::ivec3, ChunkState> m_chunkStates;
+    std::unordered_set<glm::ivec3> m_generatedChunks;
+    
+    // Chunks to remesh at the next flushDirtyChunks and their changed slices (main thread only)
+    std::unordered_map<glm::ivec3, DirtyChunk> m_dirtyChunks;
+    
+    // Unloaded sections and meshes, restored when they come back into range (main thread only)
+    ChunkCache m_chunkCache;
+    
+    // Flag to track if face instances or draw data changed since the renderer last looked
+    bool m_needsRebuild = true;
     
-    // Combined face instances for all chunks (updated only when chunks change)
-    std::vector<BlockbenchInstanceGenerator::FaceInstance> m_allFaceInstances;
+    // Mesh jobs skipped for uniform chunks
+    size_t m_skippedUniformMeshes = 0;
     
-    // Flag to track if face instances need to be rebuilt
-    bool m_needsRebuild = true;
+    // Cancelled and wasted background work (main thread only)
+    ChunkTaskStats m_taskStats;
+    
+    // Loaded chunks whose mesh task was cancelled, re-queued if they come back
+    // into range before being unloaded (main thread only)
+    std::unordered_set<glm::ivec3> m_cancelledMeshes;
     
     // Threading components
     std::unordered_map<glm::ivec3, Task::TaskId> m_loadingChunks;
     std::unordered_map<glm::ivec3, Task::TaskId> m_meshingChunks;
     
     // Thread synchronization
-    mutable std::shared_mutex m_chunksMutex;  // Reader-writer lock for chunk map
+    mutable std::shared_mutex m_chunksMutex;  // Reader-writer lock for meshes, octree and chunk map writes
     mutable std::mutex m_loadingMutex;
     mutable std::mutex m_meshingMutex;
     
-    // Per-chunk fine-grained locking
-    mutable std::unordered_map<glm::ivec3, std::shared_ptr<std::mutex>> m_chunkMutexes;
-    mutable std::mutex m_chunkMutexesMutex;
-    
     // Completed chunks ready to be integrated
     std::queue<std::pair<glm::ivec3, std::unique_ptr<ChunkData>>> m_completedChunks;
     std::mutex m_completedMutex;
@@ -215,16 +474,9 @@ private:
     std::queue<CompletedMesh> m_completedMeshes;
     std::mutex m_completedMeshMutex;
     
-    // Rebuild the combined face instance vector
-    void rebuildAllFaceInstances();
-    
-    // Rebuild indirect draw commands
+    // Rebuild per-chunk draw data from the arena slabs, O(chunks)
     void rebuildIndirectCommands();
     
-    // Per-chunk locking helpers
-    std::shared_ptr<std::mutex> getChunkMutex(const glm::ivec3& chunkPos) const;
-    void removeChunkMutex(const glm::ivec3& chunkPos);
-    
     // Indirect draw manager
     IndirectDrawManager m_indirectDrawManager;
     
@@ -10,44 +10,59 @@
 #include "extended_chunk_data.h"
 #include "face_visibility_mask.h"
 #include "face_visibility_mask_generator.h"
+#include "occupancy_masks.h"
+#include "face_arena.h"
 #include <memory>
 #include <unordered_map>
 #include <string>
 #include <array>
 #include <cstdint>
+#include <optional>
+#include <span>
+#include <memory_resource>
 
 namespace Zerith {
 
-// Structure to hold faces separated by render layer
+// Slices of a chunk per axis (x, y, z): bit s stands for the blocks at coordinate s
+using ChunkSliceMask = std::array<uint16_t, 3>;
+constexpr ChunkSliceMask ALL_CHUNK_SLICES{0xFFFF, 0xFFFF, 0xFFFF};
+
+// Structure to hold faces separated by render layer. Meshing tasks allocate it
+// from their ScratchArena and only keep the packed ChunkMesh
 struct LayeredChunkMesh {
-    std::array<std::vector<BlockbenchInstanceGenerator::FaceInstance>, 3> layers;
+    using FaceList = std::pmr::vector<BlockbenchInstanceGenerator::FaceInstance>;
+    
+    std::array<FaceList, RENDER_LAYER_COUNT> layers;
+    std::pmr::vector<uint32_t> sliceCounts; // Layout of ChunkMesh::sliceCounts, greedy meshes only
     
-    std::vector<BlockbenchInstanceGenerator::FaceInstance>& getOpaqueFaces() { return layers[0]; }
-    std::vector<BlockbenchInstanceGenerator::FaceInstance>& getCutoutFaces() { return layers[1]; }
-    std::vector<BlockbenchInstanceGenerator::FaceInstance>& getTranslucentFaces() { return layers[2]; }
+    LayeredChunkMesh() = default;
+    explicit LayeredChunkMesh(std::pmr::memory_resource* resource)
+        : layers{FaceList(resource), FaceList(resource), FaceList(resource)}, sliceCounts(resource) {}
     
-    const std::vector<BlockbenchInstanceGenerator::FaceInstance>& getOpaqueFaces() const { return layers[0]; }
-    const std::vector<BlockbenchInstanceGenerator::FaceInstance>& getCutoutFaces() const { return layers[1]; }
-    const std::vector<BlockbenchInstanceGenerator::FaceInstance>& getTranslucentFaces() const { return layers[2]; }
+    FaceList& getOpaqueFaces() { return layers[0]; }
+    FaceList& getCutoutFaces() { return layers[1]; }
+    FaceList& getTranslucentFaces() { return layers[2]; }
     
-    std::vector<BlockbenchInstanceGenerator::FaceInstance>& getLayer(RenderLayer layer) {
+    const FaceList& getOpaqueFaces() const { return layers[0]; }
+    const FaceList& getCutoutFaces() const { return layers[1]; }
+    const FaceList& getTranslucentFaces() const { return layers[2]; }
+    
+    FaceList& getLayer(RenderLayer layer) {
         return layers[static_cast<int>(layer)];
     }
     
-    const std::vector<BlockbenchInstanceGenerator::FaceInstance>& getLayer(RenderLayer layer) const {
+    const FaceList& getLayer(RenderLayer layer) const {
         return layers[static_cast<int>(layer)];
     }
+    
+    // Pack the layers back to back into one chunk mesh, recording each layer's range.
+    // chunkOrigin is the chunk's first block in world space
+    ChunkMesh pack(const glm::ivec3& chunkOrigin) const;
 };
 
-// Forward declaration
-class ChunkManager;
-
 class ChunkMeshGenerator {
 public:
     ChunkMeshGenerator();
-    
-    // Set ChunkManager for cross-chunk AO calculations
-    void setChunkManager(const ChunkManager* chunkManager) { m_chunkManager = chunkManager; }
 
     // Generate face instances for an entire chunk (legacy method)
     std::vector<BlockbenchInstanceGenerator::FaceInstance> generateChunkMesh(const Chunk& chunk);
@@ -79,10 +94,52 @@ public:
         const Chunk* neighborYMinus, const Chunk* neighborYPlus,
         const Chunk* neighborZMinus, const Chunk* neighborZPlus);
     
-    // Generate chunk mesh using extended 18x18x18 data to prevent border artifacts
-    std::vector<BlockbenchInstanceGenerator::FaceInstance> generateChunkMeshExtended(
-        const Chunk& chunk,
-        const std::array<BlockType, 18*18*18>& extendedBlockData);
+    // Generate chunk mesh using extended 18x18x18 data to prevent border artifacts.
+    // Uses the greedy mesher while binary meshing is enabled, otherwise one face per block face
+    LayeredChunkMesh generateChunkMeshExtended(const ExtendedChunkData& extendedData) const;
+    
+    // Same, with the snapshot's occupancy and visibility masks already built; the
+    // layers are allocated from resource
+    LayeredChunkMesh generateChunkMeshExtended(const ExtendedChunkData& extendedData,
+                                               const OccupancyMasks& occupancy,
+                                               const FaceVisibilityMask& visibilityMask,
+                                               std::pmr::memory_resource* resource =
+                                                   std::pmr::get_default_resource()) const;
+    
+    // Hash of everything the mesh of a snapshot depends on: which faces are visible,
+    // the block types behind them, AO occluders and the meshing settings. Equal hashes
+    // mean generateChunkMeshExtended would build the same mesh again
+    uint64_t computeMeshInputHash(const ExtendedChunkData& extendedData,
+                                  const OccupancyMasks& occupancy,
+                                  const FaceVisibilityMask& visibilityMask) const;
+    
+    // Rebuild a greedy mesh after block edits: only the slices in dirtySlices are meshed
+    // again, the faces of the other slices are copied from previous (the mesh of an
+    // earlier snapshot). Equal to a full remesh as long as every block that changed
+    // since previous is within one block of a dirty slice. Returns nullopt when
+    // previous can't be spliced (no slice counts, or binary meshing is off)
+    std::optional<ChunkMesh> generateChunkMeshIncremental(const ExtendedChunkData& extendedData,
+                                                          const OccupancyMasks& occupancy,
+                                                          const FaceVisibilityMask& visibilityMask,
+                                                          const ChunkMesh& previous,
+                                                          const ChunkSliceMask& dirtySlices) const;
+    
+    // Slices whose faces a change of the block at blockPos can affect (visibility and AO
+    // reach one block); blockPos may lie in the border (-1 or 16)
+    static ChunkSliceMask getSlicesAround(const glm::ivec3& blockPos);
+    
+    // Emit every visible block face on its own
+    LayeredChunkMesh generateChunkMeshPerBlock(const ExtendedChunkData& extendedData) const;
+    
+    // Merge visible full block faces into rectangles, slice by slice. Faces only merge
+    // with faces of the same block type and the same uniform AO level, so the merged
+    // quads tile the texture exactly as the individual faces did; partial faces
+    // (slabs, stairs) and faces with AO gradients are emitted per block
+    LayeredChunkMesh generateChunkMeshGreedy(const ExtendedChunkData& extendedData) const;
+    
+    // Generate chunk mesh reading the border straight from loaded neighbors
+    // (the chunks behind the view must stay valid while the snapshot is taken)
+    LayeredChunkMesh generateChunkMeshExtended(const ChunkNeighborhood& neighborhood) const;
     
     // Generate chunk mesh using pre-computed face visibility mask (optimized)
     std::vector<BlockbenchInstanceGenerator::FaceInstance> generateChunkMeshWithVisibilityMask(
@@ -150,21 +207,92 @@ private:
                                                const Chunk* neighborYMinus, const Chunk* neighborYPlus,
                                                const Chunk* neighborZMinus, const Chunk* neighborZPlus);
     
-    // Generate faces for a single block using extended chunk data
+    // Generate faces for a single block using extended chunk data and its visibility mask
     void generateBlockFacesExtended(const ExtendedChunkData& extendedData, int x, int y, int z,
-                                   std::vector<BlockbenchInstanceGenerator::FaceInstance>& faces,
-                                   const glm::ivec3& chunkWorldPos);
+                                   const FaceVisibilityMask& visibilityMask,
+                                   const OccupancyMasks& occupancy,
+                                   LayeredChunkMesh& layeredMesh,
+                                   const glm::ivec3& chunkWorldPos) const;
+    
+    // Mesher bodies, from the snapshot's occupancy and visibility masks
+    LayeredChunkMesh generateChunkMeshPerBlock(const ExtendedChunkData& extendedData,
+                                               const OccupancyMasks& occupancy,
+                                               const FaceVisibilityMask& visibilityMask,
+                                               std::pmr::memory_resource* resource) const;
+    LayeredChunkMesh generateChunkMeshGreedy(const ExtendedChunkData& extendedData,
+                                             const OccupancyMasks& occupancy,
+                                             const FaceVisibilityMask& visibilityMask,
+                                             std::pmr::memory_resource* resource) const;
+    
+    // Greedy faces of the selected slices (bit s of slices[dir]: slice s of direction dir),
+    // appended in direction and slice order and counted in layeredMesh.sliceCounts
+    void generateGreedySlices(const ExtendedChunkData& extendedData,
+                              const OccupancyMasks& occupancy,
+                              const FaceVisibilityMask& visibilityMask,
+                              const std::array<uint16_t, 6>& slices,
+                              LayeredChunkMesh& layeredMesh) const;
+    
+    // Faces without a direction, which are never culled, after the greedy slices
+    void generateUndirectedFaces(const ExtendedChunkData& extendedData,
+                                 const OccupancyMasks& occupancy,
+                                 LayeredChunkMesh& layeredMesh) const;
+    
+    // Model faces of every block type at the origin and their per-mask variants
+    void buildFaceTemplates();
     
     // Generate faces for a single block using pre-computed face visibility mask
     void generateBlockFacesWithMask(const ExtendedChunkData& extendedData, int x, int y, int z,
                                    const FaceVisibilityMask& visibilityMask,
+                                   const OccupancyMasks& occupancy,
                                    std::vector<BlockbenchInstanceGenerator::FaceInstance>& faces,
                                    const glm::ivec3& chunkWorldPos);
 
 private:
+    // A block type's model faces placed at the origin, with the render layer set
+    struct BlockFaceTemplates {
+        static constexpr uint32_t UNDIRECTED = 6;      // Direction group of faces that are never culled
+        static constexpr uint32_t VARIANT_COUNT = 64;  // One per 6-bit visible-face mask
+        
+        // Faces grouped by direction, model order within a direction, undirected last
+        std::vector<BlockbenchInstanceGenerator::FaceInstance> faces;
+        std::array<uint32_t, UNDIRECTED + 2> directionOffsets{};
+        
+        // Every face shown for each visible-face mask (bit d: direction d visible), in
+        // model order and undirected faces included, stored back to back
+        std::vector<BlockbenchInstanceGenerator::FaceInstance> variantFaces;
+        std::array<uint32_t, VARIANT_COUNT + 1> variantOffsets{};
+        
+        RenderLayer renderLayer = RenderLayer::OPAQUE;
+        std::array<int, 6> mergeableFace{-1, -1, -1, -1, -1, -1}; // Index of the lone full face per direction, or -1
+        bool hasModel = false;
+        bool hasUndirectedFaces = false;
+        
+        std::span<const BlockbenchInstanceGenerator::FaceInstance> getDirectionFaces(uint32_t direction) const {
+            return std::span(faces).subspan(directionOffsets[direction],
+                                            directionOffsets[direction + 1] - directionOffsets[direction]);
+        }
+        
+        std::span<const BlockbenchInstanceGenerator::FaceInstance> getVariant(uint32_t visibleFaces) const {
+            return std::span(variantFaces).subspan(variantOffsets[visibleFaces],
+                                                   variantOffsets[visibleFaces + 1] - variantOffsets[visibleFaces]);
+        }
+    };
+    
+    // Append a block's faces for its visible-face mask to out, placed at cell of the chunk
+    template<typename FaceVector>
+    static void emitBlockFaces(const BlockFaceTemplates& templates, uint32_t visibleFaces,
+                               const OccupancyMasks& occupancy, int x, int y, int z,
+                               const glm::ivec3& chunkWorldPos, FaceVector& out);
+    
     // Block model generators
     std::unordered_map<BlockType, std::unique_ptr<BlockbenchInstanceWrapper>> m_blockGenerators;
     
+    // Face templates indexed by block type
+    std::vector<BlockFaceTemplates> m_faceTemplates;
+    
+    // Whether any model has faces without a direction (always emitted, never culled)
+    bool m_hasUndirectedFaces = false;
+    
     // Texture array manager
     std::shared_ptr<TextureArray> m_textureArray;
     
@@ -173,9 +301,6 @@ private:
     
     // Binary meshing flag
     bool m_binaryMeshingEnabled = true;
-    
-    // ChunkManager for cross-chunk AO calculations
-    const ChunkManager* m_chunkManager = nullptr;
 };
 
 } // namespace Zerith
\ No newline at end of file
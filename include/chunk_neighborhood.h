@@ -0,0 +1,50 @@
+#pragma once
+
+#include <array>
+#include <glm/glm.hpp>
+#include "chunk.h"
+
+namespace Zerith {
+
+/**
+ * Non-owning view over a chunk and its loaded neighbors.
+ * Resolves extended coordinates (-1 to 16 on each axis) to the chunk that
+ * actually owns the block, so the 1-block border is read from neighbors on
+ * demand instead of being duplicated into every chunk.
+ *
+ * The view holds raw pointers: the caller must keep the chunks alive (and
+ * unmodified) for as long as the view is read, typically by holding the
+ * chunk map's shared lock.
+ */
+class ChunkNeighborhood {
+public:
+    explicit ChunkNeighborhood(const Chunk& center);
+
+    /**
+     * Register the neighbor at the given chunk offset (each component -1, 0 or 1).
+     * Passing nullptr marks the neighbor as not loaded.
+     */
+    void setNeighbor(const glm::ivec3& offset, const Chunk* neighbor);
+
+    /**
+     * Get block at extended coordinates (-1 to 16 inclusive).
+     * Border blocks whose owning neighbor is not loaded mirror the nearest
+     * block of the center chunk, so faces toward unloaded chunks are culled
+     * like interior faces until the neighbor arrives and triggers a remesh.
+     */
+    BlockType getBlock(int x, int y, int z) const;
+
+    const Chunk& getCenter() const { return *m_center; }
+    glm::ivec3 getChunkPosition() const { return m_center->getChunkPosition(); }
+
+private:
+    // Index into the 3x3x3 neighbor table for a chunk offset
+    static constexpr int getNeighborIndex(int dx, int dy, int dz) {
+        return (dx + 1) + (dy + 1) * 3 + (dz + 1) * 9;
+    }
+
+    const Chunk* m_center;
+    std::array<const Chunk*, 27> m_neighbors{};
+};
+
+} // namespace Zerith
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+namespace Zerith {
+
+/**
+ * Streaming 64-bit hash for detecting changed data, such as a chunk's meshing input.
+ *
+ * Each word is folded in with a multiply and xor-shift and the result goes through
+ * the MurmurHash3 finalizer. Fast and well mixed, but not cryptographic and not
+ * stable across builds - only compare hashes computed by the same process.
+ */
+class ContentHash {
+public:
+    void add(uint64_t word) {
+        m_state = (m_state ^ word) * MULTIPLIER;
+        m_state ^= m_state >> 29;
+    }
+
+    void add(std::span<const uint64_t> words) {
+        for (uint64_t word : words) {
+            add(word);
+        }
+    }
+
+    // Never 0, so 0 can stand for "no hash"
+    uint64_t finish() const {
+        uint64_t hash = m_state;
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 33;
+        hash *= 0xC4CEB9FE1A85EC53ull;
+        hash ^= hash >> 33;
+        return hash != 0 ? hash : 1;
+    }
+
+private:
+    static constexpr uint64_t MULTIPLIER = 0x9E3779B97F4A7C15ull;
+
+    uint64_t m_state = 0x2545F4914F6CDD1Dull;
+};
+
+} // namespace Zerith
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace Zerith {
+
+// Epoch-based memory reclamation for lock-free readers.
+//
+// Readers pin the current epoch for the duration of a lookup with an
+// EpochReclaimer::Guard. Writers hand unlinked objects to retire() instead of
+// deleting them; an object is freed only once every reader that could still
+// see it has unpinned, i.e. the global epoch advanced twice past its retirement.
+class EpochReclaimer {
+public:
+    static constexpr int MAX_THREADS = 256;
+
+    // Pins the calling thread to the current epoch. Guards may nest
+    class Guard {
+    public:
+        Guard();
+        ~Guard();
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+    };
+
+    // Shared instance used by all lock-free structures
+    static EpochReclaimer& get();
+
+    ~EpochReclaimer();
+
+    // Defer deletion of an object no longer reachable by new readers
+    template<typename T>
+    void retire(T* object) {
+        if (object) {
+            retireRaw(object, [](void* ptr) { delete static_cast<T*>(ptr); });
+        }
+    }
+
+    // Try to advance the epoch and free everything no reader can still hold.
+    // Cheap enough to call once per frame
+    void collect();
+
+    size_t getRetiredCount() const;
+    uint64_t getEpoch() const { return m_globalEpoch.load(std::memory_order_relaxed); }
+
+private:
+    EpochReclaimer() = default;
+
+    struct alignas(64) ThreadRecord {
+        std::atomic<uint64_t> epoch{0};   // 0 while the thread is not reading
+        std::atomic<bool> claimed{false};
+    };
+
+    struct RetiredObject {
+        uint64_t epoch;
+        void* object;
+        void (*deleter)(void*);
+    };
+
+    void retireRaw(void* object, void (*deleter)(void*));
+
+    // Record slot of the calling thread, claimed on first use and released on thread exit
+    ThreadRecord& getThreadRecord();
+    int claimRecord();
+    void releaseRecord(int index);
+
+    std::atomic<uint64_t> m_globalEpoch{1};
+    std::array<ThreadRecord, MAX_THREADS> m_records;
+
+    mutable std::mutex m_retiredMutex;
+    std::vector<RetiredObject> m_retired;
+};
+
+} // namespace Zerith
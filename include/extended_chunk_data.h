@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <glm/glm.hpp>
 #include "chunk.h"
+#include "chunk_neighborhood.h"
 
 namespace Zerith {
 
@@ -11,6 +12,9 @@ namespace Zerith {
  * Extended chunk data that includes a 1-block border from neighboring chunks.
  * This provides 18x18x18 block data (16x16x16 chunk + 1-block border on each side)
  * for efficient face culling without chunk border artifacts.
+ *
+ * This is a transient snapshot taken per meshing job, so workers can read it
+ * without holding any chunk locks. Chunks themselves only store 16x16x16.
  */
 class ExtendedChunkData {
 public:
@@ -19,14 +23,12 @@ public:
     static constexpr int BORDER_SIZE = 1;
 
     /**
-     * Construct extended chunk data from pre-sampled 18x18x18 block data.
-     * This constructor takes the complete 18x18x18 data that should already
-     * include the center chunk + 1-block border from all directions.
-     * @param blockData The 18x18x18 block data array
-     * @param chunkPos The position of the center chunk
+     * Snapshot the center chunk plus its 1-block border from a neighborhood view.
+     * The chunks referenced by the view must stay alive and unmodified for
+     * the duration of the constructor.
+     * @param neighborhood View over the center chunk and its loaded neighbors
      */
-    ExtendedChunkData(const std::array<BlockType, EXTENDED_VOLUME>& blockData, 
-                      const glm::ivec3& chunkPos);
+    explicit ExtendedChunkData(const ChunkNeighborhood& neighborhood);
 
     /**
      * Get block at extended coordinates.
@@ -36,6 +38,12 @@ public:
      */
     BlockType getBlock(int x, int y, int z) const;
 
+    /**
+     * Replace a block of the snapshot, e.g. to apply an edit without taking a new one.
+     * Coordinates outside -1 to 16 are ignored.
+     */
+    void setBlock(int x, int y, int z, BlockType type);
+
     /**
      * Check if a face should be rendered using the extended data.
      * This prevents chunk border artifacts by having access to neighboring blocks.
@@ -51,6 +59,16 @@ public:
      */
     bool isFaceVisibleByDirection(int x, int y, int z, int faceDir) const;
 
+    /**
+     * Check whether the center 16x16x16 region contains only air.
+     */
+    bool isCenterEmpty() const { return m_centerSolidBlocks == 0; }
+
+    /**
+     * Get the position of the center chunk in chunk coordinates.
+     */
+    const glm::ivec3& getChunkPosition() const { return m_chunkPosition; }
+
 private:
     /**
      * Convert extended coordinates to 1D array index.
@@ -73,6 +91,7 @@ private:
     }
 
     std::array<BlockType, EXTENDED_VOLUME> m_blocks;
+    int m_centerSolidBlocks = 0; // Non-air blocks in the center region, kept up to date by setBlock
     glm::ivec3 m_chunkPosition; // Position of the center chunk
 };
 
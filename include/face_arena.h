@@ -0,0 +1,156 @@
+#pragma once
+
+#include "chunk.h"
+#include "packed_face.h"
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtx/hash.hpp>
+
+namespace Zerith {
+
+// Immutable mesh of one chunk. Shared by reference between the arena, the
+// unload cache and the renderer's pending uploads, so the faces exist once on
+// the CPU however many of them hold it
+struct ChunkMesh {
+    // Faces grouped by render layer: opaque, then cutout, then translucent
+    std::vector<PackedFace> faces;
+    std::array<uint32_t, RENDER_LAYER_COUNT> layerCounts{};
+    uint64_t generation = 0;  // Increases with every mesh integrated by the ChunkManager
+    uint64_t inputHash = 0;   // ChunkMeshGenerator::computeMeshInputHash of its snapshot, 0 if unknown
+    
+    // Faces per layer, direction and slice (the faces' block coordinate along the
+    // direction's axis), followed by each layer's undirected faces, in face order.
+    // Only greedy meshes with faces record them; remeshes after block edits rebuild
+    // the slices around the edit and copy the rest (ChunkMeshGenerator::generateChunkMeshIncremental)
+    std::vector<uint32_t> sliceCounts;
+    
+    static constexpr size_t UNDIRECTED_GROUP = 6 * Chunk::CHUNK_SIZE;
+    static constexpr size_t GROUPS_PER_LAYER = UNDIRECTED_GROUP + 1;
+    
+    static constexpr size_t getSliceGroup(size_t layer, int direction, int slice) {
+        return layer * GROUPS_PER_LAYER + static_cast<size_t>(direction * Chunk::CHUNK_SIZE + slice);
+    }
+
+    // First face of a layer, relative to the start of the mesh
+    uint32_t getLayerOffset(RenderLayer layer) const {
+        uint32_t offset = 0;
+        for (size_t i = 0; i < static_cast<size_t>(layer); ++i) {
+            offset += layerCounts[i];
+        }
+        return offset;
+    }
+
+    std::span<const PackedFace> getLayerFaces(RenderLayer layer) const {
+        return std::span(faces).subspan(getLayerOffset(layer), layerCounts[static_cast<size_t>(layer)]);
+    }
+};
+
+using ChunkMeshSnapshot = std::shared_ptr<const ChunkMesh>;
+
+/**
+ * Face slot allocator for the GPU face buffer, one slab per chunk mesh.
+ *
+ * Every chunk owns one slab (a contiguous run of face slots) in the GPU face
+ * buffer. A remeshed chunk reuses its own slab when the new mesh fits,
+ * otherwise it moves to a free block; freed slabs go back to a coalescing
+ * free list. The arena keeps no face data of its own: each slab references
+ * the chunk's mesh snapshot, and every write is queued as an upload of that
+ * snapshot so the renderer copies only what changed, straight from it. The
+ * slot space only grows (doubling), so integrating a mesh costs O(mesh size)
+ * regardless of how many chunks are loaded.
+ *
+ * Slots outside live slabs hold stale data on the GPU and are never
+ * referenced by the per-chunk draw data.
+ */
+class FaceArena {
+public:
+    struct Slab {
+        uint32_t offset = 0;    // First face slot
+        uint32_t capacity = 0;  // Reserved slots
+        uint32_t count = 0;     // Faces in use
+        ChunkMeshSnapshot mesh; // Faces in the slab, null while the chunk has no mesh
+    };
+
+    // Mesh of a chunk to copy into slots starting at offset
+    struct Upload {
+        glm::ivec3 chunkPos;
+        uint32_t offset;
+        ChunkMeshSnapshot mesh;
+    };
+
+    // Store a chunk's mesh, replacing any previous one. An empty or null mesh
+    // keeps the chunk registered without reserving slots
+    void update(const glm::ivec3& chunkPos, ChunkMeshSnapshot mesh);
+
+    // Release a chunk's slab, returns false if the chunk had no mesh
+    bool remove(const glm::ivec3& chunkPos);
+
+    // Drop every slab; the slot space keeps its size
+    void clear();
+
+    bool contains(const glm::ivec3& chunkPos) const { return m_slabs.contains(chunkPos); }
+
+    // Faces of one chunk, empty if it has no mesh
+    std::span<const PackedFace> getFaces(const glm::ivec3& chunkPos) const;
+
+    // Shared snapshot of one chunk's mesh, null if it has none
+    ChunkMeshSnapshot getMesh(const glm::ivec3& chunkPos) const;
+
+    const std::unordered_map<glm::ivec3, Slab>& getSlabs() const { return m_slabs; }
+
+    // Face slots the GPU buffer must hold
+    uint32_t getCapacity() const { return m_capacity; }
+
+    // Bumped on every change, so consumers can tell whether anything moved
+    uint64_t getVersion() const { return m_version; }
+
+    // Live faces across all slabs, and slots not reserved by any slab
+    size_t getFaceCount() const { return m_faceCount; }
+    size_t getFreeSlotCount() const { return m_capacity - m_reservedSlots; }
+
+    // Bytes of face data referenced by the slabs (each mesh counted once)
+    size_t getFaceMemoryUsage() const { return m_faceBytes; }
+
+    // Slabs written since the last call that are still live, at most one per chunk.
+    // Writes superseded by a later remesh, move or removal are dropped, so the
+    // uploads never overlap and may be copied in any order
+    std::vector<Upload> takePendingUploads();
+    void clearPendingUploads() { m_pendingUploads.clear(); }
+
+private:
+    static constexpr uint32_t SLAB_GRANULARITY = 64;
+    static constexpr uint32_t MIN_CAPACITY = 1u << 16;
+
+    // Slots reserved for a mesh of this size, with headroom so small remesh changes stay in place
+    static uint32_t slabCapacityFor(uint32_t faceCount);
+
+    // Free-list allocation; grows the slot space when no free block fits
+    uint32_t allocate(uint32_t capacity);
+    void release(uint32_t offset, uint32_t capacity);
+
+    void insertFreeBlock(uint32_t offset, uint32_t size);
+    void eraseFreeBlock(std::map<uint32_t, uint32_t>::iterator it);
+
+    uint32_t m_capacity = 0;
+    uint32_t m_top = 0;  // Slots at and above this were never handed out or were returned to the tail
+
+    // Free blocks below m_top, by offset (for coalescing) and by size (for best fit)
+    std::map<uint32_t, uint32_t> m_freeByOffset;
+    std::multimap<uint32_t, uint32_t> m_freeBySize;
+
+    std::unordered_map<glm::ivec3, Slab> m_slabs;
+    std::vector<Upload> m_pendingUploads;
+    uint64_t m_version = 0;
+    size_t m_faceCount = 0;
+    size_t m_faceBytes = 0;
+    size_t m_reservedSlots = 0;
+};
+
+} // namespace Zerith
@@ -1,7 +1,7 @@
 #pragma once
 
-#include <bitset>
 #include <array>
+#include <bit>
 #include <cstdint>
 #include <glm/glm.hpp>
 
@@ -27,8 +27,9 @@ public:
         EAST = 5    // (1, 0, 0)
     };
     
-    // One bit mask per face direction
-    using FaceMask = std::bitset<CHUNK_VOLUME>;
+    // One bit mask per face direction, bit index as coordsToIndex(); each 64-bit
+    // word holds four consecutive 16-block X rows
+    using FaceMask = std::array<uint64_t, CHUNK_VOLUME / 64>;
     
     FaceVisibilityMask() = default;
     
@@ -44,7 +45,7 @@ public:
      */
     bool isFaceVisible(int x, int y, int z, FaceDirection direction) const {
         int index = coordsToIndex(x, y, z);
-        return m_visibleFaces[static_cast<int>(direction)][index];
+        return (m_visibleFaces[static_cast<int>(direction)][index >> 6] >> (index & 63)) & 1;
     }
     
     /**
@@ -61,7 +62,39 @@ public:
      */
     void setFaceVisible(int x, int y, int z, FaceDirection direction, bool visible) {
         int index = coordsToIndex(x, y, z);
-        m_visibleFaces[static_cast<int>(direction)][index] = visible;
+        uint64_t& word = m_visibleFaces[static_cast<int>(direction)][index >> 6];
+        const uint64_t bit = uint64_t{1} << (index & 63);
+        word = visible ? (word | bit) : (word & ~bit);
+    }
+    
+    /**
+     * Set the visibility of a whole X row at once (bit x = block x).
+     */
+    void setRowVisible(int y, int z, FaceDirection direction, uint16_t row) {
+        int index = coordsToIndex(0, y, z);
+        uint64_t& word = m_visibleFaces[static_cast<int>(direction)][index >> 6];
+        const int shift = index & 63;
+        word = (word & ~(uint64_t{0xFFFF} << shift)) | (uint64_t{row} << shift);
+    }
+    
+    /**
+     * Get the visibility of a whole X row (bit x = block x).
+     */
+    uint16_t getRowVisible(int y, int z, FaceDirection direction) const {
+        int index = coordsToIndex(0, y, z);
+        return static_cast<uint16_t>(m_visibleFaces[static_cast<int>(direction)][index >> 6] >> (index & 63));
+    }
+    
+    /**
+     * Get all six faces of a block at once (bit d = FaceDirection d visible).
+     */
+    uint32_t getVisibleFaces(int x, int y, int z) const {
+        const int index = coordsToIndex(x, y, z);
+        uint32_t faces = 0;
+        for (int dir = 0; dir < 6; ++dir) {
+            faces |= static_cast<uint32_t>((m_visibleFaces[dir][index >> 6] >> (index & 63)) & 1) << dir;
+        }
+        return faces;
     }
     
     /**
@@ -78,8 +111,10 @@ public:
      */
     size_t getTotalVisibleFaces() const {
         size_t total = 0;
-        for (int i = 0; i < 6; ++i) {
-            total += m_visibleFaces[i].count();
+        for (const auto& mask : m_visibleFaces) {
+            for (uint64_t word : mask) {
+                total += std::popcount(word);
+            }
         }
         return total;
     }
@@ -88,8 +123,8 @@ public:
      * Clear all face visibility (set all faces to invisible).
      */
     void clear() {
-        for (int i = 0; i < 6; ++i) {
-            m_visibleFaces[i].reset();
+        for (auto& mask : m_visibleFaces) {
+            mask.fill(0);
         }
     }
     
@@ -144,7 +179,7 @@ public:
 private:
     // Bit masks for each face direction
     // Index matches FaceDirection enum values
-    std::array<FaceMask, 6> m_visibleFaces;
+    std::array<FaceMask, 6> m_visibleFaces{};
 };
 
 } // namespace Zerith
\ No newline at end of file
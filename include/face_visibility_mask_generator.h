@@ -2,6 +2,7 @@
 
 #include "face_visibility_mask.h"
 #include "extended_chunk_data.h"
+#include "occupancy_masks.h"
 #include "block_properties.h"
 #include "blocks.h"
 
@@ -15,12 +16,42 @@ class FaceVisibilityMaskGenerator {
 public:
     /**
      * Generate face visibility mask for a chunk using extended chunk data.
+     * Builds the occupancy masks for the snapshot and culls whole rows at a time.
      * 
      * @param extendedData 18x18x18 chunk data with neighbor borders
      * @return Pre-computed face visibility mask
      */
     static FaceVisibilityMask generateMask(const ExtendedChunkData& extendedData);
 
+    /**
+     * Generate face visibility mask from prebuilt occupancy masks.
+     * Each 16-block row is culled with shifts and AND-NOT against the neighbor
+     * row; only transparent blocks facing transparent blocks fall back to
+     * comparing block types.
+     * 
+     * @param extendedData Snapshot the occupancy masks were built from
+     * @param occupancy Per-category occupancy of the snapshot
+     * @return Pre-computed face visibility mask
+     */
+    static FaceVisibilityMask generateMask(const ExtendedChunkData& extendedData, const OccupancyMasks& occupancy);
+
+    /**
+     * Generate face visibility mask by testing every face of every block.
+     * Reference implementation for the bitwise kernel, kept for benchmarks.
+     * 
+     * @param extendedData 18x18x18 chunk data with neighbor borders
+     * @return Pre-computed face visibility mask
+     */
+    static FaceVisibilityMask generateMaskPerVoxel(const ExtendedChunkData& extendedData);
+
+    /**
+     * Generate face visibility mask reading borders straight from loaded neighbors.
+     * 
+     * @param neighborhood View over the chunk and its neighbors (must stay valid during the call)
+     * @return Pre-computed face visibility mask
+     */
+    static FaceVisibilityMask generateMask(const ChunkNeighborhood& neighborhood);
+
 private:
     /**
      * Check if a face should be visible based on culling rules.
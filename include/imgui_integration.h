@@ -65,7 +65,7 @@ public:
     void renderPerformanceWindow();
     void renderCameraWindow(const Zerith::Player& player);
     void renderChunkWindow(const Zerith::ChunkManager& chunkManager);
-    void renderDebugWindow(const Zerith::Player* player, const Zerith::ChunkManager* chunkManager);
+    void renderDebugWindow(const Zerith::Player* player, Zerith::ChunkManager* chunkManager);
     
     void setShowPerformance(bool show) { m_showPerformance = show; }
     void setShowCamera(bool show) { m_showCamera = show; }
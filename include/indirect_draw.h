@@ -23,8 +23,9 @@ struct ChunkDrawData {
     alignas(16) float maxBounds[3];
     float padding2;
     uint32_t firstFaceIndex;
-    uint32_t faceCount;
-    uint32_t padding3[2];
+    uint32_t layerFaceCounts[3];  // Opaque, cutout and translucent faces, stored back to back from firstFaceIndex
+    alignas(16) int32_t origin[3];  // World block position packed face positions are relative to
+    uint32_t padding3;
 };
 
 // Indirect draw manager
@@ -33,13 +34,14 @@ public:
     IndirectDrawManager() = default;
     ~IndirectDrawManager() = default;
     
-    // Add chunk data without creating a draw command
-    void addChunkData(uint32_t faceCount, const float* minBounds, const float* maxBounds, uint32_t firstFaceIndex);
+    // Add chunk data without creating a draw command; layerFaceCounts holds one count per render layer
+    void addChunkData(const uint32_t* layerFaceCounts, const float* minBounds, const float* maxBounds,
+                      uint32_t firstFaceIndex, const int32_t* origin);
     
     // Set a single draw command for all chunks
     void setSingleDrawCommand(uint32_t taskWorkgroups, uint32_t y = 1, uint32_t z = 1);
     
-    // Add a draw command for a chunk (legacy)
+    // Add a draw command for a chunk, all faces in the opaque layer (legacy)
     void addChunkDrawCommand(uint32_t faceCount, const float* minBounds, const float* maxBounds, uint32_t firstFaceIndex);
     
     // Clear all commands
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Zerith {
+
+// Resident memory of the process as reported by the OS, 0 where unavailable
+namespace MemoryStats {
+
+// Highest resident set size the process has reached, in bytes
+size_t getPeakResidentBytes();
+
+// Current resident set size, in bytes
+size_t getCurrentResidentBytes();
+
+} // namespace MemoryStats
+
+} // namespace Zerith
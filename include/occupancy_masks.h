@@ -0,0 +1,60 @@
+#pragma once
+
+#include "extended_chunk_data.h"
+#include <array>
+#include <cstdint>
+
+namespace Zerith {
+
+/**
+ * Per-category occupancy bitmasks over a padded 18x18x18 chunk snapshot.
+ *
+ * Each category stores one 32-bit word per (y, z) row of the padded region;
+ * bit (x + 1) is set when the block at extended coordinate x belongs to the
+ * category. Neighbors along X are a shift of the same word and neighbors
+ * along Y and Z are adjacent words, so culling a whole row against its
+ * neighbors takes a handful of AND / AND-NOT operations (see
+ * FaceVisibilityMaskGenerator::generateMask).
+ */
+class OccupancyMasks {
+public:
+    static constexpr int PADDED_SIZE = ExtendedChunkData::EXTENDED_SIZE;
+    static constexpr int ROW_COUNT = PADDED_SIZE * PADDED_SIZE;
+
+    enum Category : int {
+        OPAQUE = 0,        // Non-air blocks that are not transparent
+        CULLABLE,          // Opaque blocks whose faces may be culled (stairs never are)
+        TRANSPARENT,       // Glass, leaves, fluids
+        FLUID,             // Water: transparent but culled by full faces of opaque neighbors
+        FULL_FACE_DOWN,    // Opaque blocks whose face in this direction covers the neighbor
+        FULL_FACE_UP,      // (FULL_FACE_DOWN + face direction, stairs never occlude)
+        FULL_FACE_NORTH,
+        FULL_FACE_SOUTH,
+        FULL_FACE_WEST,
+        FULL_FACE_EAST,
+        AO_OCCLUDER,       // Blocks that darken neighboring face vertices (VoxelAO::isBlockOccluding)
+        CATEGORY_COUNT
+    };
+
+    using Rows = std::array<uint32_t, ROW_COUNT>;
+
+    explicit OccupancyMasks(const ExtendedChunkData& extendedData);
+
+    // Row of a category at extended coordinates y, z (-1 to 16)
+    uint32_t getRow(Category category, int y, int z) const {
+        return m_rows[category][getRowIndex(y, z)];
+    }
+
+    static constexpr Category fullFace(int faceDirection) {
+        return static_cast<Category>(FULL_FACE_DOWN + faceDirection);
+    }
+
+    static constexpr int getRowIndex(int y, int z) {
+        return (y + ExtendedChunkData::BORDER_SIZE) + (z + ExtendedChunkData::BORDER_SIZE) * PADDED_SIZE;
+    }
+
+private:
+    std::array<Rows, CATEGORY_COUNT> m_rows{};
+};
+
+} // namespace Zerith
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "blockbench_instance_generator.h"
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+namespace Zerith {
+
+/**
+ * Compact face instance, the format chunk meshes are stored and uploaded in.
+ *
+ * A FaceInstance spends 84 bytes on a float world position, a quaternion that
+ * only depends on the face direction, float scale, UV and AO. Chunk faces
+ * live on a 1/16 block grid inside their chunk, so a face packs into four
+ * words relative to the chunk origin (ChunkDrawData carries the origin):
+ *
+ *   position  x | y << 10 | z << 20          1/16 block, biased by POSITION_BIAS
+ *   shape     width | height << 10           1/16 block, up to 64 blocks for merged quads
+ *             | direction << 20 | ao << 23   AO is 2 bits per corner, levels 0..3 of 1.0, before the
+ *                                            strength multiplier (a uniform the shader applies)
+ *   uvMin     u | v << 12 | layer low << 24  UV in 1/4 pixels
+ *   uvMax     u | v << 12 | layer high << 24 16-bit texture layer, MISSING_TEXTURE_LAYER kept
+ *
+ * The decode in mesh_shader.glsl must match this layout.
+ */
+struct PackedFace {
+    using FaceInstance = BlockbenchInstanceGenerator::FaceInstance;
+
+    uint32_t position;
+    uint32_t shape;
+    uint32_t uvMin;
+    uint32_t uvMax;
+
+    static constexpr float POSITION_SCALE = 16.0f;  // Position and size units per block
+    static constexpr int POSITION_BIAS = 128;       // Lets faces reach 8 blocks outside the chunk
+    static constexpr float UV_SCALE = 4.0f;         // UV units per texture pixel
+    static constexpr uint32_t MISSING_TEXTURE_LAYER = 0xFFFFFFFFu;
+
+    // Pack a face whose world position lies near chunkOrigin (the chunk's first block in world space).
+    // Values outside the encodable range are clamped; the render layer is not stored
+    static PackedFace pack(const FaceInstance& face, const glm::ivec3& chunkOrigin);
+
+    // Rebuild the full face; exact for faces on the 1/16 grid with AO at the 2-bit levels
+    FaceInstance unpack(const glm::ivec3& chunkOrigin, RenderLayer renderLayer = RenderLayer::OPAQUE) const;
+
+    // 2-bit level (0..3) an AO value is stored as
+    static uint32_t aoLevel(float ao);
+
+    uint32_t getFaceDirection() const { return (shape >> 20) & 0x7u; }
+    uint32_t getTextureLayer() const;
+};
+
+static_assert(sizeof(PackedFace) == 16, "PackedFace must match the shader's 16-byte face");
+
+} // namespace Zerith
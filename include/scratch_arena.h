@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace Zerith {
+
+// Per-thread bump allocator for the temporaries of one task, such as the face
+// layers of a mesh before it is packed.
+//
+// Allocating bumps a pointer and deallocating does nothing; everything is freed
+// at once when the outermost Scope ends. Requests that don't fit the block go
+// to overflow blocks on the heap, and the next reset grows the block to the
+// high-water mark, so once warmed up a task makes no heap allocations for its
+// temporaries and workers don't contend on the global allocator.
+//
+// Nothing allocated from the arena may outlive the Scope: copy results out
+// (LayeredChunkMesh::pack does) before it ends.
+class ScratchArena final : public std::pmr::memory_resource {
+public:
+    static constexpr size_t MAX_BLOCK_BYTES = size_t{16} << 20;  // Larger high-water marks keep overflowing
+
+    struct Stats {
+        size_t allocations = 0;          // Requests served
+        size_t overflowAllocations = 0;  // ...of which came from the heap
+        size_t blockBytes = 0;           // Current block size
+    };
+
+    // Resets the calling thread's arena when the outermost Scope ends. Scopes may nest
+    class Scope {
+    public:
+        Scope();
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        std::pmr::memory_resource* resource() const { return &m_arena; }
+
+    private:
+        ScratchArena& m_arena;
+    };
+
+    // The calling thread's arena
+    static ScratchArena& get();
+
+    // Counters of the calling thread's arena, since the thread started
+    const Stats& getStats() const { return m_stats; }
+
+private:
+    ScratchArena() = default;
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    // Free everything, growing the block if the last task overflowed it
+    void reset();
+
+    std::unique_ptr<std::byte[]> m_block;
+    size_t m_blockSize = 0;
+    size_t m_used = 0;
+    std::vector<std::unique_ptr<std::byte[]>> m_overflow;
+    size_t m_overflowBytes = 0;
+    int m_scopeDepth = 0;
+    Stats m_stats;
+};
+
+} // namespace Zerith
@@ -53,6 +53,11 @@ public:
     }
     
     TaskPriority getPriority() const { return m_priority; }
+    void setPriority(TaskPriority priority) { m_priority = priority; }
+    
+    // Finer ordering within a priority bucket (higher runs first)
+    int getScore() const { return m_score; }
+    void setScore(int score) { m_score = score; }
     TaskId getId() const { return m_id; }
     const std::string& getName() const { return m_name; }
     auto getTimestamp() const { return m_timestamp; }
@@ -61,6 +66,9 @@ public:
         if (m_priority != other.m_priority) {
             return m_priority > other.m_priority;  // Higher priority value = lower priority
         }
+        if (m_score != other.m_score) {
+            return m_score < other.m_score;  // Higher score first within a bucket
+        }
         return m_timestamp > other.m_timestamp;  // Older tasks first for same priority
     }
 
@@ -69,6 +77,7 @@ public:
 private:
     TaskFunc m_function;
     TaskPriority m_priority;
+    int m_score = 0;
     std::string m_name;
     TaskId m_id;
     std::chrono::steady_clock::time_point m_timestamp;
@@ -125,8 +134,11 @@ public:
         std::atomic<uint64_t> tasksCompleted{0};
         std::atomic<uint64_t> tasksStolen{0};
         std::atomic<uint64_t> tasksCancelled{0};
+        std::atomic<uint64_t> tasksDropped{0};  // Cancelled before running, removed without executing
         std::atomic<uint64_t> totalWaitTime{0};  // in microseconds
         std::atomic<uint64_t> totalExecutionTime{0};  // in microseconds
+        std::atomic<uint64_t> interactiveCompleted{0};  // Tasks run from the interactive lane (not dropped ones)
+        std::atomic<uint64_t> interactiveWaitTime{0};   // in microseconds, submit to start
         std::atomic<uint32_t> activeThreads{0};
         
         // Copy constructor for Stats
@@ -135,8 +147,11 @@ public:
             : tasksCompleted(other.tasksCompleted.load())
             , tasksStolen(other.tasksStolen.load())
             , tasksCancelled(other.tasksCancelled.load())
+            , tasksDropped(other.tasksDropped.load())
             , totalWaitTime(other.totalWaitTime.load())
             , totalExecutionTime(other.totalExecutionTime.load())
+            , interactiveCompleted(other.interactiveCompleted.load())
+            , interactiveWaitTime(other.interactiveWaitTime.load())
             , activeThreads(other.activeThreads.load()) {}
     };
     
@@ -164,7 +179,7 @@ public:
     // Submit a task and get both a future and the task ID
     template<typename F>
     auto submitTaskWithId(F&& f, TaskPriority priority = TaskPriority::Normal, 
-                         const std::string& name = "") 
+                         const std::string& name = "", int score = 0) 
         -> std::pair<std::future<decltype(f())>, Task::TaskId> {
         using ReturnType = decltype(f());
         
@@ -175,6 +190,7 @@ public:
         std::future<ReturnType> result = task->get_future();
         
         Task wrappedTask([task]() { (*task)(); }, priority, name);
+        wrappedTask.setScore(score);
         Task::TaskId taskId = wrappedTask.getId();
         submitTask(std::move(wrappedTask));
         
@@ -184,9 +200,43 @@ public:
     // Submit a task without a future
     void submitTask(Task task);
     
-    // Cancel a task by ID
+    // Submit to the interactive lane, for work the player is waiting on (e.g. remeshing
+    // an edited chunk). Interactive tasks run in submission order ahead of every queued
+    // task: each worker checks the lane before taking its next task, and a reserved
+    // worker runs nothing else, so one is never stuck behind long background tasks
+    template<typename F>
+    auto submitInteractiveTaskWithId(F&& f, const std::string& name = "")
+        -> std::pair<std::future<decltype(f())>, Task::TaskId> {
+        using ReturnType = decltype(f());
+        
+        auto task = std::make_shared<std::packaged_task<ReturnType()>>(
+            std::forward<F>(f)
+        );
+        
+        std::future<ReturnType> result = task->get_future();
+        
+        Task wrappedTask([task]() { (*task)(); }, TaskPriority::Critical, name);
+        Task::TaskId taskId = wrappedTask.getId();
+        submitInteractiveTask(std::move(wrappedTask));
+        
+        return std::make_pair(std::move(result), taskId);
+    }
+    
+    void submitInteractiveTask(Task task);
+    
+    // Cancel a task by ID. A task that has not started is dropped from its queue
+    // when a worker reaches it and never runs
     bool cancelTask(Task::TaskId taskId);
     
+    // ID of the task running on the calling worker thread, 0 outside of a task
+    static Task::TaskId getCurrentTaskId() { return s_currentTaskId; }
+    
+    // Let the caller update the priority and score of every task still waiting in the
+    // global queue, then restore queue order. Cancelled tasks found on the way are dropped.
+    // Critical tasks already handed to worker queues are not visited. Returns the number
+    // of tasks left in the global queue
+    size_t reprioritizeTasks(const std::function<void(Task&)>& update);
+    
     // Cancel all tasks with a given priority or lower
     void cancelTasksByPriority(TaskPriority maxPriority);
     
@@ -199,7 +249,7 @@ public:
     // Dynamically adjust thread count based on load
     void setThreadCount(size_t count);
     
-    // Get current thread count
+    // Get current thread count, not counting the reserved interactive worker
     size_t getThreadCount() const { return m_threads.size(); }
     
     // Enable/disable work stealing
@@ -209,7 +259,14 @@ public:
     
 private:
     void workerThread(size_t threadIndex);
+    void interactiveWorkerThread();
+    void runTask(Task& task, std::chrono::steady_clock::time_point waitStart);
+    void runInteractiveTask(Task& task, std::chrono::steady_clock::time_point waitStart);
+    bool tryPopInteractiveTask(Task& task);
+    bool tryGetInteractiveTask(Task& task);
     bool tryGetTask(Task& task, size_t threadIndex);
+    bool tryDequeueTask(Task& task, size_t threadIndex);
+    void dropCancelledTask(const Task& task);
     bool tryStealTask(Task& task, size_t threadIndex);
     void updateStats(const Task& task, uint64_t waitTime, uint64_t executionTime);
     
@@ -221,6 +278,12 @@ private:
     mutable std::mutex m_globalQueueMutex;
     std::condition_variable m_condition;
     
+    // Interactive lane, FIFO, guarded by m_globalQueueMutex. Its reserved worker
+    // waits on its own condition so a wake-up can't go to a general worker
+    std::deque<Task> m_interactiveQueue;
+    std::condition_variable m_interactiveCondition;
+    std::thread m_interactiveThread;
+    
     // Task tracking
     std::unordered_map<Task::TaskId, std::weak_ptr<std::atomic<bool>>> m_taskCancellationFlags;
     mutable std::mutex m_taskMapMutex;
@@ -234,6 +297,9 @@ private:
     
     // Thread-local random for work stealing
     static thread_local std::mt19937 s_rng;
+    
+    // Task currently executing on this worker
+    static thread_local Task::TaskId s_currentTaskId;
 };
 
 // Global thread pool instance
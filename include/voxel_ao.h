@@ -3,6 +3,9 @@
 #include <glm/glm.hpp>
 #include "chunk.h"
 #include "blocks.h"
+#include "occupancy_masks.h"
+#include <array>
+#include <cstdint>
 
 namespace Zerith {
 
@@ -19,10 +22,34 @@ public:
                                   int dx2, int dy2, int dz2,  // Second neighbor offset
                                   int dx3, int dy3, int dz3); // Corner neighbor offset
     
-    // Calculate AO values for all 4 vertices of a face with cross-chunk support
+    // Calculate AO values for all 4 vertices of a face by querying the world.
+    // Meshing doesn't use this, it works from the chunk snapshot (calculateRowAO)
     // Face direction: 0=down, 1=up, 2=north, 3=south, 4=west, 5=east
     static glm::vec4 calculateFaceAO(const ChunkManager* chunkManager, const glm::ivec3& chunkWorldPos, int x, int y, int z, int faceDirection);
     
+    // AO of the 16 faces in one X row of a chunk: a 2-bit 0fps level per vertex
+    // (0 = fully occluded, 3 = open), stored as two bitplanes with bit x per face
+    struct RowAO {
+        std::array<uint16_t, 4> low{0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF};
+        std::array<uint16_t, 4> high{0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF};
+        
+        int getLevel(int x, int vertex) const {
+            return ((low[vertex] >> x) & 1) | ((high[vertex] >> x) & 1) << 1;
+        }
+    };
+    
+    // AO of every face in the row at (y, z) facing faceDirection, from the occluder
+    // masks of the chunk's padded snapshot. Works on whole rows with bit operations,
+    // so all 16 faces cost the same 12 row reads as one
+    static RowAO calculateRowAO(const OccupancyMasks& masks, int y, int z, int faceDirection);
+    
+    // AO values of the face at x in a row, with debug mode applied. The strength
+    // multiplier is not: it is a render setting the shader applies
+    static glm::vec4 getFaceAO(const RowAO& rowAO, int x);
+    
+    // AO values of a single face from the chunk's padded snapshot
+    static glm::vec4 calculateFaceAO(const OccupancyMasks& masks, int x, int y, int z, int faceDirection);
+    
     // Check if a block contributes to occlusion
     static bool isBlockOccluding(BlockType blockType);
     
@@ -35,6 +62,10 @@ public:
         s_debugAO = glm::vec4(tl, bl, tr, br);
     }
     static void setAOStrengthMultiplier(float multiplier) { s_aoMultiplier = multiplier; }
+    static float getAOStrengthMultiplier() { return s_aoMultiplier; }
+    
+    // Hash of the settings that change meshes (not the strength multiplier), part of a mesh's input hash
+    static uint64_t getSettingsHash();
     
     // Debug visualization - returns AO as colors for easy identification
     static glm::vec4 calculateFaceAODebug(const Chunk& chunk, int x, int y, int z, int faceDirection);
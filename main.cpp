@@ -30,6 +30,7 @@
 // Chunk support
 #include "chunk.h"
 #include "chunk_mesh_generator.h"
+#include "packed_face.h"
 #include "indirect_draw.h"
 #include "chunk_manager.h"
 
@@ -173,6 +174,10 @@ const uint32_t WIDTH = 1400;
 const uint32_t HEIGHT = 900;
 const int MAX_FRAMES_IN_FLIGHT = 2;
 
+// The render layer push constant selects the layer's face range in the task
+// shader and the alpha handling in the fragment shader
+const VkShaderStageFlags RENDER_LAYER_PUSH_STAGES = VK_SHADER_STAGE_TASK_BIT_EXT | VK_SHADER_STAGE_FRAGMENT_BIT;
+
 // Validation layers for debugging
 const std::vector<const char*> validationLayers = {
     "VK_LAYER_KHRONOS_validation"
@@ -210,6 +215,9 @@ struct UniformBufferObject {
     // Frustum planes for GPU culling (6 planes * 16 bytes = 96 bytes)
     // Each plane is (normal.x, normal.y, normal.z, distance)
     alignas(16) glm::vec4 frustumPlanes[6];
+    
+    // AO strength multiplier, applied to the AO levels stored in the faces (4 bytes)
+    alignas(4) float aoStrength;
 
     // Total: 136 bytes (4 + 64 + 64 + 4)
 };
@@ -230,18 +238,6 @@ struct TransparencyTextureIndices {
     alignas(4) uint32_t padding;            // Padding for alignment
 };
 
-// Face instance data for storage buffer
-struct FaceInstanceData {
-    alignas(16) glm::vec4 position; // vec3 + padding
-    alignas(16) glm::vec4 rotation; // quaternion
-    alignas(16) glm::vec4 scale;    // face scale (width, height, 1.0, faceDirection)
-    alignas(16) glm::vec4 uv;       // UV coordinates [minU, minV, maxU, maxV]
-    alignas(16) glm::vec4 ao;       // Ambient occlusion values for 4 vertices
-    uint32_t textureLayer;          // Texture array layer index
-    uint32_t padding[3];            // Padding to maintain 16-byte alignment
-};
-
-
 // Queue family indices helper
 struct QueueFamilyIndices {
     std::optional<uint32_t> graphicsFamily;
@@ -368,20 +364,20 @@ private:
     VkBuffer faceInstanceBuffer;
     VkDeviceMemory faceInstanceBufferMemory;
     
-    // Layered face instance buffers
-    VkBuffer opaqueInstanceBuffer = VK_NULL_HANDLE;
-    VkDeviceMemory opaqueInstanceBufferMemory = VK_NULL_HANDLE;
-    VkBuffer cutoutInstanceBuffer = VK_NULL_HANDLE;
-    VkDeviceMemory cutoutInstanceBufferMemory = VK_NULL_HANDLE;
-    VkBuffer translucentInstanceBuffer = VK_NULL_HANDLE;
-    VkDeviceMemory translucentInstanceBufferMemory = VK_NULL_HANDLE;
-    
     // Indirect draw buffers
     VkBuffer indirectDrawBuffer;
     VkDeviceMemory indirectDrawBufferMemory;
     VkBuffer chunkDataBuffer;
     VkDeviceMemory chunkDataBufferMemory;
     void* faceInstanceBufferMapped;
+    size_t faceInstanceBufferCapacity = 0; // Face slots in faceInstanceBuffer
+    
+    // Per frame in flight staging for the face, chunk data and indirect buffer updates,
+    // copied on the GPU at the start of that frame's commands. Grown on demand
+    std::vector<VkBuffer> uploadStagingBuffers;
+    std::vector<VkDeviceMemory> uploadStagingBuffersMemory;
+    std::vector<void*> uploadStagingBuffersMapped;
+    std::vector<VkDeviceSize> uploadStagingBufferSizes;
     
     // Chunk block data buffer for GPU AO calculation
     VkBuffer chunkBlockBuffer;
@@ -420,13 +416,6 @@ private:
     BlockbenchModel::Model currentModel;
     BlockbenchInstanceGenerator::ModelInstances currentInstances;
     
-    // Layered face instances for proper transparency rendering
-    struct LayeredInstances {
-        std::vector<BlockbenchInstanceGenerator::FaceInstance> opaque;
-        std::vector<BlockbenchInstanceGenerator::FaceInstance> cutout;
-        std::vector<BlockbenchInstanceGenerator::FaceInstance> translucent;
-    } layeredInstances;
-    
     // Chunk support
     std::unique_ptr<Zerith::ChunkManager> chunkManager;
     
@@ -559,87 +548,34 @@ private:
     void updateChunks() {
         if (!chunkManager) return;
         
-        // Store previous face count
-        size_t previousFaceCount = currentInstances.faces.size();
-        
         // Update loaded chunks based on player position
-        chunkManager->updateLoadedChunks(player ? player->getPosition() : glm::vec3(0.0f));
-        
-        // Only update face instances if they have changed (avoids unnecessary operations)
-        if (chunkManager->hasFaceInstancesChanged()) {
-            // Get face instances for rendering (only when changed)
-            auto newFaces = chunkManager->getFaceInstancesWhenChanged();
-            currentInstances.faces = std::move(newFaces);
-            
-            // Separate faces into render layers
-            separateFacesByRenderLayer();
-            
-            // Recreate buffer since face instances changed
-            recreateFaceInstanceBuffer();
-            recreateLayeredInstanceBuffers();
+        if (player) {
+            chunkManager->updateLoadedChunks(player->getPosition(), player->getCameraFront(), player->getVelocity());
+        } else {
+            chunkManager->updateLoadedChunks(glm::vec3(0.0f));
         }
     }
     
-    void separateFacesByRenderLayer() {
-        // Clear previous layered instances
-        layeredInstances.opaque.clear();
-        layeredInstances.cutout.clear();
-        layeredInstances.translucent.clear();
-        
+    // Reallocate the face buffer if the arena outgrew it. Meshes written since then
+    // are uploaded by recordFrameUploads
+    void syncFaceInstanceBuffer() {
         if (!chunkManager) return;
         
-        // For now, we need to classify faces based on the block registry
-        // since we don't have access to per-face block type information
-        // This is a temporary implementation - ideally faces would be 
-        // pre-separated during chunk mesh generation
-        
-        // Get all chunks and their face instances
-        const auto& allFaces = currentInstances.faces;
-        
-        // Separate faces based on texture layer (temporary hack)
-        // This is a simplified approach - proper implementation would need block type per face
-        auto meshGenerator = chunkManager->getMeshGenerator();
-        auto textureArray = meshGenerator->getTextureArray();
-        
-        // Use the render layer information directly from the face instances
-        for (const auto& face : allFaces) {
-            switch (face.renderLayer) {
-                case Zerith::RenderLayer::OPAQUE:
-                    layeredInstances.opaque.push_back(face);
-                    break;
-                case Zerith::RenderLayer::CUTOUT:
-                    layeredInstances.cutout.push_back(face);
-                    break;
-                case Zerith::RenderLayer::TRANSLUCENT:
-                    layeredInstances.translucent.push_back(face);
-                    break;
-                default:
-                    // Default to opaque for unknown layers
-                    layeredInstances.opaque.push_back(face);
-                    break;
-            }
-        }
-        
-        // LOG_INFO("Separated %zu faces: %zu opaque, %zu cutout, %zu translucent",
-        //          allFaces.size(),
-        //          layeredInstances.opaque.size(),
-        //          layeredInstances.cutout.size(),
-        //          layeredInstances.translucent.size());
+        const Zerith::FaceArena& arena = chunkManager->getFaceArena();
+        if (arena.getCapacity() <= faceInstanceBufferCapacity) return;
         
-        // Debug: count faces by render layer from face instances
-        int opaqueCount = 0, cutoutCount = 0, translucentCount = 0;
-        for (const auto& face : allFaces) {
-            switch (face.renderLayer) {
-                case Zerith::RenderLayer::OPAQUE: opaqueCount++; break;
-                case Zerith::RenderLayer::CUTOUT: cutoutCount++; break;
-                case Zerith::RenderLayer::TRANSLUCENT: translucentCount++; break;
+        // The arena grew: reallocate the buffer (waiting for the device) and upload every slab
+        Zerith::FaceArena& faceArena = chunkManager->acquireFaceArenaChanges();
+        recreateFaceInstanceBuffer(faceArena.getCapacity());
+        for (const auto& [chunkPos, slab] : faceArena.getSlabs()) {
+            if (slab.mesh) {
+                writeFaceInstances(slab.mesh->faces.data(), slab.offset, slab.count);
             }
         }
-        // LOG_INFO("Face instances by render layer: %d opaque, %d cutout, %d translucent",
-        //          opaqueCount, cutoutCount, translucentCount);
+        faceArena.clearPendingUploads();
     }
     
-    void recreateFaceInstanceBuffer() {
+    void recreateFaceInstanceBuffer(size_t faceCapacity) {
         // Wait for device to be idle
         vkDeviceWaitIdle(device);
         
@@ -649,15 +585,15 @@ private:
             vkFreeMemory(device, faceInstanceBufferMemory, nullptr);
         }
         
-        // Create new buffer
-        createFaceInstanceBuffer();
+        // Create new buffer; the caller fills it
+        allocateFaceInstanceBuffer(faceCapacity);
         
         // Update descriptor sets
         for (size_t i = 0; i < swapChainImages.size(); i++) {
             VkDescriptorBufferInfo storageBufferInfo{};
             storageBufferInfo.buffer = faceInstanceBuffer;
             storageBufferInfo.offset = 0;
-            storageBufferInfo.range = sizeof(FaceInstanceData) * currentInstances.faces.size();
+            storageBufferInfo.range = sizeof(Zerith::PackedFace) * faceInstanceBufferCapacity;
 
             VkWriteDescriptorSet descriptorWrite{};
             descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
@@ -716,7 +652,6 @@ private:
         createFramebuffers();
         createUniformBuffers();
         createFaceInstanceBuffer();
-        createLayeredInstanceBuffers();
         createAABBInstanceBuffer();
         createIndirectDrawBuffers(); // Re-enabled for proper indirect drawing
         createDescriptorPool();
@@ -1947,7 +1882,7 @@ private:
 
         // Push constant for render layer
         VkPushConstantRange pushConstantRange{};
-        pushConstantRange.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+        pushConstantRange.stageFlags = RENDER_LAYER_PUSH_STAGES;
         pushConstantRange.offset = 0;
         pushConstantRange.size = sizeof(uint32_t);
 
@@ -2401,104 +2336,41 @@ private:
             currentInstances.faces.push_back(BlockbenchInstanceGenerator::FaceInstance());
         }
         
-        // Calculate buffer size for all face instances
-        VkDeviceSize bufferSize = sizeof(FaceInstanceData) * currentInstances.faces.size();
-        
-        createBuffer(
-            bufferSize,
-            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
-            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-            faceInstanceBuffer,
-            faceInstanceBufferMemory
-        );
-        
-        // Map and populate the buffer
-        vkMapMemory(device, faceInstanceBufferMemory, 0, bufferSize, 0, &faceInstanceBufferMapped);
-        
-        // Copy face instance data
-        FaceInstanceData* mappedData = static_cast<FaceInstanceData*>(faceInstanceBufferMapped);
-        for (size_t i = 0; i < currentInstances.faces.size(); i++) {
-            const auto& face = currentInstances.faces[i];
-            mappedData[i].position = glm::vec4(face.position, 1.0f); // Add w component
-            mappedData[i].rotation = face.rotation;
-            mappedData[i].scale = glm::vec4(face.scale, static_cast<float>(face.faceDirection)); // Pack direction in w
-            mappedData[i].uv = face.uv; // Copy UV coordinates
-            mappedData[i].ao = face.ao; // Copy ambient occlusion values
-            mappedData[i].textureLayer = face.textureLayer; // Copy texture layer index
-            
-            // Print face position for debugging
-            const char* directionNames[] = {"DOWN", "UP", "NORTH", "SOUTH", "WEST", "EAST"};
-            const char* directionName = (face.faceDirection >= 0 && face.faceDirection < 6) ? 
-                                       directionNames[face.faceDirection] : "UNKNOWN";
+        // Allocate for all face instances and copy them in, packed relative to the world origin
+        std::vector<Zerith::PackedFace> packedFaces;
+        packedFaces.reserve(currentInstances.faces.size());
+        for (const auto& face : currentInstances.faces) {
+            packedFaces.push_back(Zerith::PackedFace::pack(face, glm::ivec3(0)));
         }
+        allocateFaceInstanceBuffer(packedFaces.size());
+        writeFaceInstances(packedFaces.data(), 0, packedFaces.size());
         
         // LOG_DEBUG("Face instance buffer created with %zu instances (%zu bytes)", 
-        //           currentInstances.faces.size(), bufferSize);
-    }
-    
-    void createLayeredInstanceBuffers() {
-        createLayeredInstanceBuffer(layeredInstances.opaque, opaqueInstanceBuffer, opaqueInstanceBufferMemory);
-        createLayeredInstanceBuffer(layeredInstances.cutout, cutoutInstanceBuffer, cutoutInstanceBufferMemory);
-        createLayeredInstanceBuffer(layeredInstances.translucent, translucentInstanceBuffer, translucentInstanceBufferMemory);
+        //           currentInstances.faces.size(), sizeof(Zerith::PackedFace) * faceInstanceBufferCapacity);
     }
     
-    void createLayeredInstanceBuffer(const std::vector<BlockbenchInstanceGenerator::FaceInstance>& faces,
-                                   VkBuffer& buffer, VkDeviceMemory& bufferMemory) {
-        if (faces.empty()) {
-            buffer = VK_NULL_HANDLE;
-            bufferMemory = VK_NULL_HANDLE;
-            return;
-        }
-        
-        VkDeviceSize bufferSize = sizeof(FaceInstanceData) * faces.size();
+    void allocateFaceInstanceBuffer(size_t faceCapacity) {
+        VkDeviceSize bufferSize = sizeof(Zerith::PackedFace) * faceCapacity;
         
         createBuffer(
             bufferSize,
-            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-            buffer,
-            bufferMemory
+            faceInstanceBuffer,
+            faceInstanceBufferMemory
         );
         
-        // Map and populate the buffer
-        void* bufferMapped;
-        vkMapMemory(device, bufferMemory, 0, bufferSize, 0, &bufferMapped);
-        
-        // Copy face instance data
-        FaceInstanceData* mappedData = static_cast<FaceInstanceData*>(bufferMapped);
-        for (size_t i = 0; i < faces.size(); i++) {
-            const auto& face = faces[i];
-            mappedData[i].position = glm::vec4(face.position, 1.0f);
-            mappedData[i].rotation = face.rotation;
-            mappedData[i].scale = glm::vec4(face.scale, static_cast<float>(face.faceDirection));
-            mappedData[i].uv = face.uv;
-            mappedData[i].ao = face.ao;
-            mappedData[i].textureLayer = face.textureLayer;
-            mappedData[i].padding[0] = 0;
-            mappedData[i].padding[1] = 0;
-            mappedData[i].padding[2] = 0;
-        }
-        
-        vkUnmapMemory(device, bufferMemory);
+        // Stays mapped for full uploads while the device is idle; anything the GPU may
+        // be reading is updated through recordFrameUploads instead
+        vkMapMemory(device, faceInstanceBufferMemory, 0, bufferSize, 0, &faceInstanceBufferMapped);
+        faceInstanceBufferCapacity = faceCapacity;
     }
     
-    void recreateLayeredInstanceBuffers() {
-        // Clean up old buffers
-        if (opaqueInstanceBuffer != VK_NULL_HANDLE) {
-            vkDestroyBuffer(device, opaqueInstanceBuffer, nullptr);
-            vkFreeMemory(device, opaqueInstanceBufferMemory, nullptr);
-        }
-        if (cutoutInstanceBuffer != VK_NULL_HANDLE) {
-            vkDestroyBuffer(device, cutoutInstanceBuffer, nullptr);
-            vkFreeMemory(device, cutoutInstanceBufferMemory, nullptr);
-        }
-        if (translucentInstanceBuffer != VK_NULL_HANDLE) {
-            vkDestroyBuffer(device, translucentInstanceBuffer, nullptr);
-            vkFreeMemory(device, translucentInstanceBufferMemory, nullptr);
-        }
-        
-        // Create new buffers
-        createLayeredInstanceBuffers();
+    // Copy packed faces into slots [first, first + count); the buffer uses the packed layout as is.
+    // Only safe while no frame in flight reads the buffer
+    void writeFaceInstances(const Zerith::PackedFace* faces, size_t first, size_t count) {
+        Zerith::PackedFace* mappedData = static_cast<Zerith::PackedFace*>(faceInstanceBufferMapped) + first;
+        std::memcpy(mappedData, faces, sizeof(Zerith::PackedFace) * count);
     }
     
     void createAABBInstanceBuffer() {
@@ -2533,7 +2405,7 @@ private:
         
         createBuffer(
             indirectBufferSize,
-            VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+            VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
             indirectDrawBuffer,
             indirectDrawBufferMemory
@@ -2544,7 +2416,7 @@ private:
         
         createBuffer(
             chunkDataSize,
-            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
             chunkDataBuffer,
             chunkDataBufferMemory
@@ -2644,7 +2516,7 @@ private:
             VkDescriptorBufferInfo storageBufferInfo{};
             storageBufferInfo.buffer = faceInstanceBuffer;
             storageBufferInfo.offset = 0;
-            storageBufferInfo.range = sizeof(FaceInstanceData) * currentInstances.faces.size();
+            storageBufferInfo.range = sizeof(Zerith::PackedFace) * faceInstanceBufferCapacity;
 
             // Grass texture indices buffer info
             VkDescriptorBufferInfo grassTextureBufferInfo{};
@@ -2816,26 +2688,114 @@ private:
                 throw std::runtime_error("failed to create synchronization objects for a frame!");
             }
         }
+        
+        // Upload staging per frame in flight, allocated on first use
+        uploadStagingBuffers.assign(MAX_FRAMES_IN_FLIGHT, VK_NULL_HANDLE);
+        uploadStagingBuffersMemory.assign(MAX_FRAMES_IN_FLIGHT, VK_NULL_HANDLE);
+        uploadStagingBuffersMapped.assign(MAX_FRAMES_IN_FLIGHT, nullptr);
+        uploadStagingBufferSizes.assign(MAX_FRAMES_IN_FLIGHT, 0);
     }
 
-    void updateIndirectDrawBuffer() {
+    // Make a frame's staging buffer hold at least size bytes. Only called once the
+    // frame's fence has been waited on, so the old buffer is no longer in use
+    void ensureUploadStagingCapacity(size_t frame, VkDeviceSize size) {
+        if (uploadStagingBufferSizes[frame] >= size) return;
+        
+        if (uploadStagingBuffers[frame] != VK_NULL_HANDLE) {
+            vkUnmapMemory(device, uploadStagingBuffersMemory[frame]);
+            vkDestroyBuffer(device, uploadStagingBuffers[frame], nullptr);
+            vkFreeMemory(device, uploadStagingBuffersMemory[frame], nullptr);
+        }
+        
+        // Grow by doubling so streaming bursts don't reallocate every frame
+        const VkDeviceSize minSize = 1 << 20;
+        VkDeviceSize capacity = std::max({size, uploadStagingBufferSizes[frame] * 2, minSize});
+        
+        createBuffer(
+            capacity,
+            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+            uploadStagingBuffers[frame],
+            uploadStagingBuffersMemory[frame]
+        );
+        vkMapMemory(device, uploadStagingBuffersMemory[frame], 0, capacity, 0, &uploadStagingBuffersMapped[frame]);
+        uploadStagingBufferSizes[frame] = capacity;
+    }
+    
+    // Record this frame's buffer updates before the render pass: chunk meshes written
+    // since the last frame, the per-chunk draw data and the indirect draw command.
+    // Frames still in flight read the same buffers, so nothing is written from the CPU;
+    // the data is staged in this frame's buffer and copied on the GPU between barriers,
+    // after earlier frames finish reading. That covers slabs overwritten in place and
+    // slabs freed and reused by another chunk alike
+    void recordFrameUploads(VkCommandBuffer commandBuffer) {
         if (!chunkManager) return;
         
+        const std::vector<Zerith::FaceArena::Upload> uploads =
+            chunkManager->acquireFaceArenaChanges().takePendingUploads();
+        
         const auto& indirectManager = chunkManager->getIndirectDrawManager();
+        const auto& chunkData = indirectManager.getChunkData();
         const auto& drawCommands = indirectManager.getDrawCommands();
+        size_t maxChunks = calculateMaxChunks(chunkManager->getRenderDistance());
+        size_t chunkCount = std::min(chunkData.size(), maxChunks);
+        size_t commandCount = std::min(drawCommands.size(), maxChunks);
         
-        if (drawCommands.empty()) return;
+        VkDeviceSize faceBytes = 0;
+        for (const auto& upload : uploads) {
+            faceBytes += sizeof(Zerith::PackedFace) * upload.mesh->faces.size();
+        }
+        const VkDeviceSize chunkDataBytes = sizeof(Zerith::ChunkDrawData) * chunkCount;
+        const VkDeviceSize commandBytes = sizeof(Zerith::DrawMeshTasksIndirectCommand) * commandCount;
+        if (faceBytes + chunkDataBytes + commandBytes == 0) return;
         
-        // Update indirect draw buffer with all commands at once
-        int renderDistance = chunkManager->getRenderDistance();
-        size_t maxCommands = calculateMaxChunks(renderDistance);
-        size_t commandCount = std::min(drawCommands.size(), maxCommands);
+        ensureUploadStagingCapacity(currentFrame, faceBytes + chunkDataBytes + commandBytes);
+        char* staging = static_cast<char*>(uploadStagingBuffersMapped[currentFrame]);
+        VkDeviceSize stagingOffset = 0;
         
-        void* data;
-        vkMapMemory(device, indirectDrawBufferMemory, 0, 
-                   sizeof(Zerith::DrawMeshTasksIndirectCommand) * commandCount, 0, &data);
-        memcpy(data, drawCommands.data(), sizeof(Zerith::DrawMeshTasksIndirectCommand) * commandCount);
-        vkUnmapMemory(device, indirectDrawBufferMemory);
+        // Uploads from the arena never overlap, so they can share one copy command
+        std::vector<VkBufferCopy> faceCopies;
+        faceCopies.reserve(uploads.size());
+        for (const auto& upload : uploads) {
+            VkDeviceSize bytes = sizeof(Zerith::PackedFace) * upload.mesh->faces.size();
+            std::memcpy(staging + stagingOffset, upload.mesh->faces.data(), bytes);
+            faceCopies.push_back({stagingOffset, sizeof(Zerith::PackedFace) * upload.offset, bytes});
+            stagingOffset += bytes;
+        }
+        
+        VkBufferCopy chunkDataCopy{stagingOffset, 0, chunkDataBytes};
+        std::memcpy(staging + stagingOffset, chunkData.data(), chunkDataBytes);
+        stagingOffset += chunkDataBytes;
+        
+        VkBufferCopy commandCopy{stagingOffset, 0, commandBytes};
+        std::memcpy(staging + stagingOffset, drawCommands.data(), commandBytes);
+        
+        // Earlier frames' reads of these buffers finish before they are overwritten...
+        const VkPipelineStageFlags readStages = VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT |
+                                                VK_PIPELINE_STAGE_TASK_SHADER_BIT_EXT |
+                                                VK_PIPELINE_STAGE_MESH_SHADER_BIT_EXT;
+        vkCmdPipelineBarrier(commandBuffer, readStages, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+                             0, nullptr, 0, nullptr, 0, nullptr);
+        
+        VkBuffer stagingBuffer = uploadStagingBuffers[currentFrame];
+        if (!faceCopies.empty()) {
+            vkCmdCopyBuffer(commandBuffer, stagingBuffer, faceInstanceBuffer,
+                            static_cast<uint32_t>(faceCopies.size()), faceCopies.data());
+        }
+        if (chunkDataBytes > 0) {
+            vkCmdCopyBuffer(commandBuffer, stagingBuffer, chunkDataBuffer, 1, &chunkDataCopy);
+        }
+        if (commandBytes > 0) {
+            vkCmdCopyBuffer(commandBuffer, stagingBuffer, indirectDrawBuffer, 1, &commandCopy);
+        }
+        
+        // ...and this frame's draws see the new data
+        VkMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, readStages, 0,
+                             1, &barrier, 0, nullptr, 0, nullptr);
     }
     
     // Extract frustum planes from view-projection matrix
@@ -2883,26 +2843,6 @@ private:
         }
     }
     
-    void updateChunkDataBuffer() {
-        if (!chunkManager) return;
-        
-        const auto& indirectManager = chunkManager->getIndirectDrawManager();
-        const auto& chunkData = indirectManager.getChunkData();
-        
-        if (chunkData.empty()) return;
-        
-        // Update chunk data buffer
-        int renderDistance = chunkManager->getRenderDistance();
-        size_t maxChunks = calculateMaxChunks(renderDistance);
-        size_t chunkCount = std::min(chunkData.size(), maxChunks);
-        
-        void* data;
-        vkMapMemory(device, chunkDataBufferMemory, 0,
-                   sizeof(Zerith::ChunkDrawData) * chunkCount, 0, &data);
-        memcpy(data, chunkData.data(), sizeof(Zerith::ChunkDrawData) * chunkCount);
-        vkUnmapMemory(device, chunkDataBufferMemory);
-    }
-    
     void updateUniformBuffer(uint32_t currentImage) {
         static auto startTime = std::chrono::high_resolution_clock::now();
         auto currentTime = std::chrono::high_resolution_clock::now();
@@ -2942,6 +2882,9 @@ private:
         // Set camera position
         ubo.cameraPos = glm::vec4(playerPos, 1.0f);
         
+        // A render setting, so changing it doesn't remesh
+        ubo.aoStrength = Zerith::VoxelAO::getAOStrengthMultiplier();
+        
         // Extract frustum planes from view-projection matrix
         glm::mat4 viewProj = ubo.proj * ubo.view;
         extractFrustumPlanes(viewProj, ubo.frustumPlanes);
@@ -3077,6 +3020,9 @@ private:
             throw std::runtime_error("failed to begin recording command buffer!");
         }
 
+        // Copies can't be recorded inside a render pass
+        recordFrameUploads(commandBuffer);
+
         VkRenderPassBeginInfo renderPassInfo{};
         renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
         renderPassInfo.renderPass = renderPass;
@@ -3108,29 +3054,27 @@ private:
         scissor.extent = swapChainExtent;
         vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
 
-        // For now, render all faces with opaque pipeline to verify basic rendering works
-        // The layered separation is working, but we need to update descriptor sets properly
+        // Each pass draws one render layer; chunk meshes store their layers as separate
+        // face ranges, so the task shader emits only the current layer's faces
         vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, opaquePipeline);
         vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
                               pipelineLayout, 0, 1, &descriptorSets[imageIndex], 0, nullptr);
         
         // Set render layer push constant for opaque rendering
         uint32_t renderLayer = 0; // OPAQUE
-        vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(uint32_t), &renderLayer);
+        vkCmdPushConstants(commandBuffer, pipelineLayout, RENDER_LAYER_PUSH_STAGES, 0, sizeof(uint32_t), &renderLayer);
 
         // Helper lambda to render with current setup
         auto renderCurrentFaces = [&]() {
-            if (chunkManager && currentInstances.faces.size() > 0) {
+            if (chunkManager && chunkManager->getFaceArena().getFaceCount() > 0) {
                 const auto& indirectManager = chunkManager->getIndirectDrawManager();
                 const auto& drawCommands = indirectManager.getDrawCommands();
                 
                 if (!drawCommands.empty()) {
-                    updateIndirectDrawBuffer();
-                    updateChunkDataBuffer();
                     vkCmdDrawMeshTasksIndirectEXT(commandBuffer, indirectDrawBuffer, 0, 1, 
                                                 sizeof(Zerith::DrawMeshTasksIndirectCommand));
                 }
-            } else if (currentInstances.faces.size() > 0) {
+            } else if (!chunkManager && currentInstances.faces.size() > 0) {
                 uint32_t facesPerWorkgroup = 32;
                 uint32_t faceCount = static_cast<uint32_t>(currentInstances.faces.size());
                 uint32_t totalWorkgroups = (faceCount + facesPerWorkgroup - 1) / facesPerWorkgroup;
@@ -3138,19 +3082,19 @@ private:
             }
         };
 
-        // OPAQUE PASS - Render all faces, shader will handle opaque materials
+        // OPAQUE PASS
         renderCurrentFaces();
 
-        // CUTOUT PASS - Render all faces again, shader will handle cutout materials (leaves)
+        // CUTOUT PASS - alpha tested (leaves)
         vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, cutoutPipeline);
         renderLayer = 1; // CUTOUT
-        vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(uint32_t), &renderLayer);
+        vkCmdPushConstants(commandBuffer, pipelineLayout, RENDER_LAYER_PUSH_STAGES, 0, sizeof(uint32_t), &renderLayer);
         renderCurrentFaces();
 
-        // TRANSLUCENT PASS - Render all faces again, shader will handle translucent materials (water/glass)
+        // TRANSLUCENT PASS - alpha blended (water/glass)
         vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, translucentPipeline);
         renderLayer = 2; // TRANSLUCENT
-        vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(uint32_t), &renderLayer);
+        vkCmdPushConstants(commandBuffer, pipelineLayout, RENDER_LAYER_PUSH_STAGES, 0, sizeof(uint32_t), &renderLayer);
         renderCurrentFaces();
         
         // Draw AABB debug wireframes (including block outline)
@@ -3198,6 +3142,7 @@ private:
         }
 
         updateUniformBuffer(imageIndex);
+        syncFaceInstanceBuffer();
 
         vkResetFences(device, 1, &inFlightFences[currentFrame]);
 
@@ -3334,6 +3279,9 @@ private:
             // Process input
             processInput(deltaTime);
             
+            // Integrate finished work and remesh edits every frame, moving or not
+            updateChunks();
+            
             // Poll events and render
             glfwPollEvents();
             drawFrame();
@@ -3345,18 +3293,11 @@ private:
     void processInput(float deltaTime) {
         if (!player) return;
         
-        glm::vec3 oldPosition = player->getPosition();
-        
         // Handle player input and physics (only when mouse is captured)
         if (mouseCaptured) {
             player->handleInput(window, deltaTime, chunkManager.get());
         }
         player->update(deltaTime, chunkManager.get());
-        
-        // Update chunks if player moved
-        if (player->getPosition() != oldPosition) {
-            updateChunks();
-        }
     }
     
 
@@ -3376,20 +3317,6 @@ private:
         vkDestroyBuffer(device, faceInstanceBuffer, nullptr);
         vkFreeMemory(device, faceInstanceBufferMemory, nullptr);
         
-        // Clean up layered instance buffers
-        if (opaqueInstanceBuffer != VK_NULL_HANDLE) {
-            vkDestroyBuffer(device, opaqueInstanceBuffer, nullptr);
-            vkFreeMemory(device, opaqueInstanceBufferMemory, nullptr);
-        }
-        if (cutoutInstanceBuffer != VK_NULL_HANDLE) {
-            vkDestroyBuffer(device, cutoutInstanceBuffer, nullptr);
-            vkFreeMemory(device, cutoutInstanceBufferMemory, nullptr);
-        }
-        if (translucentInstanceBuffer != VK_NULL_HANDLE) {
-            vkDestroyBuffer(device, translucentInstanceBuffer, nullptr);
-            vkFreeMemory(device, translucentInstanceBufferMemory, nullptr);
-        }
-        
         // Clean up AABB debug resources
         if (aabbInstanceBufferMapped) {
             vkUnmapMemory(device, aabbInstanceBufferMemory);
@@ -3403,6 +3330,14 @@ private:
         vkDestroyBuffer(device, chunkDataBuffer, nullptr);
         vkFreeMemory(device, chunkDataBufferMemory, nullptr);
         
+        for (size_t i = 0; i < uploadStagingBuffers.size(); i++) {
+            if (uploadStagingBuffers[i] != VK_NULL_HANDLE) {
+                vkUnmapMemory(device, uploadStagingBuffersMemory[i]);
+                vkDestroyBuffer(device, uploadStagingBuffers[i], nullptr);
+                vkFreeMemory(device, uploadStagingBuffersMemory[i], nullptr);
+            }
+        }
+        
         vkDestroyPipeline(device, aabbDebugPipeline, nullptr);
         vkDestroyPipelineLayout(device, aabbPipelineLayout, nullptr);
         vkDestroyDescriptorSetLayout(device, aabbDescriptorSetLayout, nullptr);
@@ -86,36 +86,9 @@ void main() {
         discard;
     }
     
-    // Apply render layer specific processing based on texture layer
-    bool shouldRender = false;
-    
-    if (pc.renderLayer == 0u) { // OPAQUE layer
-        // Only render non-transparent textures (exclude water, glass, and leaves)
-        if (v_in.textureLayer != transparencyTextures.waterLayer && 
-            v_in.textureLayer != transparencyTextures.glassLayer && 
-            v_in.textureLayer != transparencyTextures.leavesLayer) {
-            shouldRender = true;
-        }
-    } else if (pc.renderLayer == 1u) { // CUTOUT layer  
-        // Only render leaves (texture layer from uniform)
-        if (v_in.textureLayer == transparencyTextures.leavesLayer) {
-            shouldRender = true;
-            // Apply alpha testing for cutout materials
-            if (texColor.a < alphaTestThreshold) {
-                discard;
-            }
-        }
-    } else if (pc.renderLayer == 2u) { // TRANSLUCENT layer
-        // Only render water and glass (texture layers from uniforms)
-        if (v_in.textureLayer == transparencyTextures.waterLayer || 
-            v_in.textureLayer == transparencyTextures.glassLayer) {
-            shouldRender = true;
-            // Keep all alpha values for blending
-        }
-    }
-    
-    // Discard fragments that don't belong to this render layer
-    if (!shouldRender) {
+    // Faces arrive already split by render layer (the task shader only emits the
+    // current pass's range), so only the cutout pass needs per-fragment work
+    if (pc.renderLayer == 1u && texColor.a < alphaTestThreshold) {
         discard;
     }
     
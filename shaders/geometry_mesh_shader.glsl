@@ -46,6 +46,7 @@ struct MeshTaskPayload {
     uint chunkIndex;
     uint firstFaceIndex;
     uint faceCount;
+    ivec3 chunkOrigin;
 };
 taskPayloadSharedEXT MeshTaskPayload payload;
 
@@ -67,24 +68,62 @@ layout(binding = 0) uniform UniformBufferObject {
     uint faceCount;
     vec4 cameraPos;
     vec4 frustumPlanes[6];
+    float aoStrength;
 } ubo;
 
-// Face instance structure
-struct FaceInstanceData {
-    vec4 position;  // vec3 + padding
-    vec4 rotation;  // quaternion
-    vec4 scale;     // face scale
-    vec4 uv;        // UV coordinates
-    vec4 ao;        // Ambient occlusion values
-    uint textureLayer;
-    uint padding[3];
+// Packed 16-byte face, see PackedFace in packed_face.h for the bit layout
+struct PackedFace {
+    uint position;  // x | y << 10 | z << 20, 1/16 block relative to the chunk origin, biased by 128
+    uint shape;     // width | height << 10 | direction << 20 | ao << 23
+    uint uvMin;     // u | v << 12 | texture layer low byte << 24, UV in 1/4 pixels
+    uint uvMax;     // u | v << 12 | texture layer high byte << 24
 };
 
-// Storage buffer for face instances
+// Storage buffer for dynamic face instances
 layout(binding = 2, std430) restrict readonly buffer FaceInstanceBuffer {
-    FaceInstanceData instances[];
+    PackedFace instances[];
 } faceInstanceBuffer;
 
+// Face rotations by direction (down, up, north, south, west, east), as in createFaceRotation
+const vec4 faceRotations[6] = {
+    vec4(-0.70710678, 0.0, 0.0, 0.70710678),
+    vec4(0.70710678, 0.0, 0.0, 0.70710678),
+    vec4(0.0, 0.0, 0.0, 1.0),
+    vec4(0.0, 1.0, 0.0, 0.0),
+    vec4(0.0, 0.70710678, 0.0, 0.70710678),
+    vec4(0.0, -0.70710678, 0.0, 0.70710678)
+};
+
+struct FaceInstance {
+    vec3 position;
+    vec4 rotation;
+    vec2 scale;
+    vec4 uv;
+    vec4 ao;
+    uint textureLayer;
+};
+
+FaceInstance unpackFace(PackedFace packed, ivec3 chunkOrigin) {
+    FaceInstance face;
+    
+    ivec3 localPos = ivec3(packed.position & 0x3FFu, (packed.position >> 10) & 0x3FFu, (packed.position >> 20) & 0x3FFu);
+    face.position = vec3(chunkOrigin) + vec3(localPos - 128) / 16.0;
+    
+    uint direction = (packed.shape >> 20) & 0x7u;
+    face.rotation = direction < 6u ? faceRotations[direction] : vec4(0.0, 0.0, 0.0, 1.0);
+    face.scale = vec2(packed.shape & 0x3FFu, (packed.shape >> 10) & 0x3FFu) / 16.0;
+    
+    face.uv = vec4(packed.uvMin & 0xFFFu, (packed.uvMin >> 12) & 0xFFFu,
+                   packed.uvMax & 0xFFFu, (packed.uvMax >> 12) & 0xFFFu) / 4.0;
+    
+    uint ao = packed.shape >> 23;
+    face.ao = clamp(vec4(ao & 0x3u, (ao >> 2) & 0x3u, (ao >> 4) & 0x3u, (ao >> 6) & 0x3u) / 3.0 * ubo.aoStrength, 0.0, 1.0);
+    
+    uint layer = (packed.uvMin >> 24) | ((packed.uvMax >> 24) << 8);
+    face.textureLayer = layer == 0xFFFFu ? 0xFFFFFFFFu : layer;
+    return face;
+}
+
 // Quaternion to matrix conversion
 mat4 quatToMat4(vec4 q) {
     q = normalize(q);
@@ -119,9 +158,9 @@ mat4 quatToMat4(vec4 q) {
     return result;
 }
 
-// Get face direction from scale.w
-uint getFaceDirection(float scaleW) {
-    return uint(scaleW);
+// Get face direction from the packed shape word (unknown directions render as down)
+uint getFaceDirection(PackedFace packed) {
+    return min((packed.shape >> 20) & 0x7u, 5u);
 }
 
 mat4 reconstructModelMatrix() {
@@ -175,15 +214,16 @@ void main() {
     uint baseTriangleIndex = localIndex * TRIANGLES_PER_FACE;
     
     // Get face instance data
-    vec3 facePosition = faceInstanceBuffer.instances[faceIndex].position.xyz;
-    vec4 faceRotation = faceInstanceBuffer.instances[faceIndex].rotation;
-    vec3 faceScale = faceInstanceBuffer.instances[faceIndex].scale.xyz;
-    float faceDirectionFloat = faceInstanceBuffer.instances[faceIndex].scale.w;
-    vec4 faceUV = faceInstanceBuffer.instances[faceIndex].uv;
-    uint textureLayer = faceInstanceBuffer.instances[faceIndex].textureLayer;
+    PackedFace packedFace = faceInstanceBuffer.instances[faceIndex];
+    FaceInstance face = unpackFace(packedFace, payload.chunkOrigin);
+    vec3 facePosition = face.position;
+    vec4 faceRotation = face.rotation;
+    vec3 faceScale = vec3(face.scale, 1.0);
+    vec4 faceUV = face.uv;
+    uint textureLayer = face.textureLayer;
     
     // Get face direction
-    uint faceDir = getFaceDirection(faceDirectionFloat);
+    uint faceDir = getFaceDirection(packedFace);
     vec3 faceNormal = faceNormals[faceDir];
     
     // Create face transformation
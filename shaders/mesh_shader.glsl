@@ -50,6 +50,7 @@ struct MeshTaskPayload {
     uint chunkIndex;
     uint firstFaceIndex;
     uint faceCount;
+    ivec3 chunkOrigin;
 };
 
 // Then declare it as shared
@@ -72,26 +73,64 @@ layout(binding = 0) uniform UniformBufferObject {
     uint faceCount;       // Number of face instances to render
     vec4 cameraPos;       // Camera position for LOD
     vec4 frustumPlanes[6]; // Frustum planes for culling
+    float aoStrength;     // AO strength multiplier
 } ubo;
 
 // Push constants removed - using UBO directly for better performance
 
-// Face instance structure for storage buffer
-struct FaceInstanceData {
-    vec4 position;  // vec3 + padding
-    vec4 rotation;  // quaternion
-    vec4 scale;     // face scale (width, height, 1.0, faceDirection)
-    vec4 uv;        // UV coordinates [minU, minV, maxU, maxV]
-    vec4 ao;        // Ambient occlusion values for 4 vertices
-    uint textureLayer;  // Texture array layer index
-    uint padding[3];    // Padding to maintain 16-byte alignment
+// Packed 16-byte face, see PackedFace in packed_face.h for the bit layout
+struct PackedFace {
+    uint position;  // x | y << 10 | z << 20, 1/16 block relative to the chunk origin, biased by 128
+    uint shape;     // width | height << 10 | direction << 20 | ao << 23
+    uint uvMin;     // u | v << 12 | texture layer low byte << 24, UV in 1/4 pixels
+    uint uvMax;     // u | v << 12 | texture layer high byte << 24
 };
 
 // Storage buffer for dynamic face instances
 layout(binding = 2, std430) restrict readonly buffer FaceInstanceBuffer {
-    FaceInstanceData instances[];
+    PackedFace instances[];
 } faceInstanceBuffer;
 
+// Face rotations by direction (down, up, north, south, west, east), as in createFaceRotation
+const vec4 faceRotations[6] = {
+    vec4(-0.70710678, 0.0, 0.0, 0.70710678),
+    vec4(0.70710678, 0.0, 0.0, 0.70710678),
+    vec4(0.0, 0.0, 0.0, 1.0),
+    vec4(0.0, 1.0, 0.0, 0.0),
+    vec4(0.0, 0.70710678, 0.0, 0.70710678),
+    vec4(0.0, -0.70710678, 0.0, 0.70710678)
+};
+
+struct FaceInstance {
+    vec3 position;
+    vec4 rotation;
+    vec2 scale;
+    vec4 uv;
+    vec4 ao;
+    uint textureLayer;
+};
+
+FaceInstance unpackFace(PackedFace packed, ivec3 chunkOrigin) {
+    FaceInstance face;
+    
+    ivec3 localPos = ivec3(packed.position & 0x3FFu, (packed.position >> 10) & 0x3FFu, (packed.position >> 20) & 0x3FFu);
+    face.position = vec3(chunkOrigin) + vec3(localPos - 128) / 16.0;
+    
+    uint direction = (packed.shape >> 20) & 0x7u;
+    face.rotation = direction < 6u ? faceRotations[direction] : vec4(0.0, 0.0, 0.0, 1.0);
+    face.scale = vec2(packed.shape & 0x3FFu, (packed.shape >> 10) & 0x3FFu) / 16.0;
+    
+    face.uv = vec4(packed.uvMin & 0xFFFu, (packed.uvMin >> 12) & 0xFFFu,
+                   packed.uvMax & 0xFFFu, (packed.uvMax >> 12) & 0xFFFu) / 4.0;
+    
+    uint ao = packed.shape >> 23;
+    face.ao = clamp(vec4(ao & 0x3u, (ao >> 2) & 0x3u, (ao >> 4) & 0x3u, (ao >> 6) & 0x3u) / 3.0 * ubo.aoStrength, 0.0, 1.0);
+    
+    uint layer = (packed.uvMin >> 24) | ((packed.uvMax >> 24) << 8);
+    face.textureLayer = layer == 0xFFFFu ? 0xFFFFFFFFu : layer;
+    return face;
+}
+
 // Storage buffer for chunk block data (for GPU AO calculation)
 layout(binding = 6, std430) restrict readonly buffer ChunkBlockBuffer {
     uint blockData[];  // Flattened 3D array: blockData[x + y*32 + z*32*32]
@@ -314,14 +353,15 @@ void main() {
     uint baseTriangleIndex = localIndex * TRIANGLES_PER_FACE;
     
     // Get face instance data from storage buffer
-    vec3 facePosition = faceInstanceBuffer.instances[faceIndex].position.xyz;
-    vec4 faceRotation = faceInstanceBuffer.instances[faceIndex].rotation;
-    vec3 faceScale = faceInstanceBuffer.instances[faceIndex].scale.xyz;
-    vec4 faceUV = faceInstanceBuffer.instances[faceIndex].uv;
-    uint textureLayer = faceInstanceBuffer.instances[faceIndex].textureLayer;
+    FaceInstance face = unpackFace(faceInstanceBuffer.instances[faceIndex], payload.chunkOrigin);
+    vec3 facePosition = face.position;
+    vec4 faceRotation = face.rotation;
+    vec3 faceScale = vec3(face.scale, 1.0);
+    vec4 faceUV = face.uv;
+    uint textureLayer = face.textureLayer;
     
     // Use pre-calculated AO values from CPU for now (GPU AO is experimental)
-    vec4 faceAO = faceInstanceBuffer.instances[faceIndex].ao;
+    vec4 faceAO = face.ao;
     
     // Create model matrix for this face
     mat4 faceRotationMatrix = quatToMat4(faceRotation);
@@ -14,7 +14,10 @@ layout(binding = 0) uniform UniformBufferObject {
     vec4 frustumPlanes[6]; // Frustum planes for culling
 } ubo;
 
-// Push constants removed - using UBO directly for better performance
+// Render layer of the current pass, shared with the fragment shader
+layout(push_constant) uniform PushConstants {
+    uint renderLayer; // 0=OPAQUE, 1=CUTOUT, 2=TRANSLUCENT
+} pc;
 
 // Chunk data for GPU culling and processing
 struct ChunkDrawData {
@@ -23,8 +26,9 @@ struct ChunkDrawData {
     vec3 maxBounds;
     float padding2;
     uint firstFaceIndex;
-    uint faceCount;
-    uint padding3[2];
+    uint layerFaceCounts[3]; // Opaque, cutout and translucent faces, back to back from firstFaceIndex
+    ivec3 origin;            // World block position the chunk's packed faces are relative to
+    uint padding3;
 };
 
 // Storage buffer for chunk data
@@ -37,6 +41,7 @@ struct MeshTaskPayload {
     uint chunkIndex;
     uint firstFaceIndex;
     uint faceCount;
+    ivec3 chunkOrigin;
 };
 
 // Then declare it as shared
@@ -80,14 +85,22 @@ void main() {
         return;
     }
     
+    // Only the faces of the current pass's render layer are drawn
+    uint layerStart = chunk.firstFaceIndex;
+    for (uint layer = 0u; layer < pc.renderLayer; layer++) {
+        layerStart += chunk.layerFaceCounts[layer];
+    }
+    uint layerFaceCount = chunk.layerFaceCounts[pc.renderLayer];
+    
     // Pass chunk info to mesh shader
     payload.chunkIndex = chunkIndex;
-    payload.firstFaceIndex = chunk.firstFaceIndex;
-    payload.faceCount = chunk.faceCount;
+    payload.firstFaceIndex = layerStart;
+    payload.faceCount = layerFaceCount;
+    payload.chunkOrigin = chunk.origin;
     
-    // Calculate how many mesh workgroups we need for this chunk's faces
+    // Calculate how many mesh workgroups we need for this layer's faces
     uint facesPerWorkgroup = 32;
-    uint numWorkgroups = (chunk.faceCount + facesPerWorkgroup - 1) / facesPerWorkgroup;
+    uint numWorkgroups = (layerFaceCount + facesPerWorkgroup - 1) / facesPerWorkgroup;
     
     // Emit mesh tasks for visible chunk
     EmitMeshTasksEXT(numWorkgroups, 1, 1);
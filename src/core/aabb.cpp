@@ -65,11 +65,20 @@ std::vector<AABB> CollisionSystem::getBlockAABBsInRegion(const AABB& region, Chu
     glm::ivec3 minBlock = glm::floor(region.min);
     glm::ivec3 maxBlock = glm::floor(region.max);
     
+    // Fetch the whole region at once instead of one getBlock per block
+    thread_local std::vector<BlockType> blocks;
+    const glm::ivec3 size = maxBlock - minBlock + glm::ivec3(1);
+    if (size.x <= 0 || size.y <= 0 || size.z <= 0) {
+        return blockAABBs;
+    }
+    blocks.resize(static_cast<size_t>(size.x) * size.y * size.z);
+    chunkManager->copyRegion(minBlock, maxBlock, std::span<BlockType>(blocks));
+    
     for (int x = minBlock.x; x <= maxBlock.x; ++x) {
         for (int y = minBlock.y; y <= maxBlock.y; ++y) {
             for (int z = minBlock.z; z <= maxBlock.z; ++z) {
-                glm::vec3 blockPos(x, y, z);
-                BlockType blockType = chunkManager->getBlock(blockPos);
+                const glm::ivec3 local = glm::ivec3(x, y, z) - minBlock;
+                BlockType blockType = blocks[local.x + (local.y + local.z * size.y) * size.x];
                 
                 if (blockType != Blocks::AIR) {
                     // Check if the block has collision using the unified blocks system
@@ -17,15 +17,16 @@ namespace Zerith {
     void Player::update(float deltaTime, ChunkManager *chunkManager) {
         applyGravity(deltaTime);
         
+        // Calculate camera direction (also used by the chunk manager for load priorities)
+        glm::vec3 cameraFront;
+        cameraFront.x = cos(m_rotation.y) * cos(m_rotation.x);
+        cameraFront.y = sin(m_rotation.x);
+        cameraFront.z = sin(m_rotation.y) * cos(m_rotation.x);
+        cameraFront = glm::normalize(cameraFront);
+        m_cameraFront = cameraFront;
+        
         // Update which block we're looking at
         if (chunkManager) {
-            // Calculate camera direction
-            glm::vec3 cameraFront;
-            cameraFront.x = cos(m_rotation.y) * cos(m_rotation.x);
-            cameraFront.y = sin(m_rotation.x);
-            cameraFront.z = sin(m_rotation.y) * cos(m_rotation.x);
-            cameraFront = glm::normalize(cameraFront);
-            
             // Get eye position
             glm::vec3 eyePosition = m_position + glm::vec3(0.0f, m_eyeHeight, 0.0f);
             
@@ -7,10 +7,137 @@
 #include "blocks.h"
 #include "profiler.h"
 #include "voxel_ao.h"
+#include "occupancy_masks.h"
+#include "content_hash.h"
+#include "scratch_arena.h"
+#include <bit>
 #include <filesystem>
 
 namespace Zerith {
 
+namespace {
+
+// A face covering a whole block side with one upright copy of its texture, which
+// can be stretched over neighboring faces by scaling it and repeating the UVs
+bool isFullBlockFace(const BlockbenchInstanceGenerator::FaceInstance& face) {
+    static constexpr int NORMAL_AXIS[6] = {1, 1, 2, 2, 0, 0};
+    const float boundary = face.faceDirection % 2 == 1 ? 1.0f : 0.0f;
+    return face.position[NORMAL_AXIS[face.faceDirection]] == boundary &&
+           face.scale.x == 1.0f && face.scale.y == 1.0f &&
+           face.uv.z - face.uv.x == 16.0f && face.uv.w - face.uv.y == 16.0f;
+}
+
+using SliceRows = std::array<uint16_t, Chunk::CHUNK_SIZE>;
+
+// Slice layout per face direction: bits run along the face quad's U axis and rows
+// along its V axis, with the sign each axis points in (see createFaceRotation)
+struct SliceAxes {
+    int bitAxis;
+    int rowAxis;
+    int sliceAxis;
+    bool bitPositive;
+    bool rowPositive;
+    
+    glm::ivec3 toCell(int slice, int row, int bit) const {
+        glm::ivec3 cell(0);
+        cell[sliceAxis] = slice;
+        cell[rowAxis] = row;
+        cell[bitAxis] = bit;
+        return cell;
+    }
+};
+
+constexpr SliceAxes SLICE_AXES[6] = {
+    {0, 2, 1, true, false},  // Down: U = +X, V = -Z
+    {0, 2, 1, true, true},   // Up: U = +X, V = +Z
+    {0, 1, 2, true, true},   // North: U = +X, V = +Y
+    {0, 1, 2, false, true},  // South: U = -X, V = +Y
+    {2, 1, 0, false, true},  // West: U = -Z, V = +Y
+    {2, 1, 0, true, true},   // East: U = +Z, V = +Y
+};
+
+// Visible faces of one slice, laid out along the direction's slice axes
+SliceRows getVisibleSliceRows(const FaceVisibilityMask& mask, FaceVisibilityMask::FaceDirection direction,
+                              const SliceAxes& axes, int slice) {
+    SliceRows rows{};
+    if (axes.bitAxis == 0) {
+        // The mask already stores X rows
+        for (int row = 0; row < Chunk::CHUNK_SIZE; ++row) {
+            const glm::ivec3 cell = axes.toCell(slice, row, 0);
+            rows[row] = mask.getRowVisible(cell.y, cell.z, direction);
+        }
+    } else {
+        // West/east faces run along Z: gather column `slice` of each X row
+        for (int y = 0; y < Chunk::CHUNK_SIZE; ++y) {
+            for (int z = 0; z < Chunk::CHUNK_SIZE; ++z) {
+                rows[y] |= static_cast<uint16_t>(((mask.getRowVisible(y, z, direction) >> slice) & 1u) << z);
+            }
+        }
+    }
+    return rows;
+}
+
+// Greedy-merge a slice in place: take the lowest run of set bits in a row with
+// ctz, then grow it over the following rows that contain the whole run
+template <typename EmitQuad>
+void mergeSliceRows(SliceRows& rows, EmitQuad&& emitQuad) {
+    for (int row = 0; row < Chunk::CHUNK_SIZE; ++row) {
+        while (rows[row] != 0) {
+            const int start = std::countr_zero(rows[row]);
+            const int width = std::countr_one(static_cast<uint16_t>(rows[row] >> start));
+            const uint16_t run = static_cast<uint16_t>(((1u << width) - 1u) << start);
+            
+            int height = 1;
+            while (row + height < Chunk::CHUNK_SIZE && (rows[row + height] & run) == run) {
+                rows[row + height] &= static_cast<uint16_t>(~run);
+                ++height;
+            }
+            rows[row] &= static_cast<uint16_t>(~run);
+            emitQuad(start, row, width, height);
+        }
+    }
+}
+
+constexpr uint16_t NO_SLOT = 0xFFFF;
+constexpr uint32_t AO_LEVELS = 4;
+
+// Per-thread working set of the greedy mesher, kept across chunks so meshing a
+// slice never allocates
+struct GreedyScratch {
+    std::vector<uint16_t> slotOfType;   // Block type -> palette slot in the current chunk, NO_SLOT if unused
+    std::vector<BlockType> palette;     // Block types given a slot in the current chunk
+    std::vector<SliceRows> keyRows;     // Per slot * AO_LEVELS + AO level: mergeable faces of the current slice
+    std::vector<uint8_t> keyTouched;    // Whether keyRows[key] has bits in the current slice
+    std::vector<uint32_t> touchedKeys;
+};
+
+GreedyScratch& getGreedyScratch() {
+    thread_local GreedyScratch scratch;
+    return scratch;
+}
+
+} // namespace
+
+ChunkMesh LayeredChunkMesh::pack(const glm::ivec3& chunkOrigin) const {
+    ChunkMesh mesh;
+    size_t total = 0;
+    for (size_t i = 0; i < layers.size(); ++i) {
+        mesh.layerCounts[i] = static_cast<uint32_t>(layers[i].size());
+        total += layers[i].size();
+    }
+    if (total > 0) {
+        mesh.sliceCounts.assign(sliceCounts.begin(), sliceCounts.end());
+    }
+    
+    mesh.faces.reserve(total);
+    for (const auto& layer : layers) {
+        for (const auto& face : layer) {
+            mesh.faces.push_back(PackedFace::pack(face, chunkOrigin));
+        }
+    }
+    return mesh;
+}
+
 ChunkMeshGenerator::ChunkMeshGenerator() {
     m_textureArray = std::make_shared<TextureArray>();
     m_faceInstancePool = std::make_unique<FaceInstancePool>(16); // Pre-allocate 16 batches
@@ -77,24 +204,85 @@ void ChunkMeshGenerator::loadBlockModels() {
     }
     
     LOG_INFO("Loaded models for %zu blocks", m_blockGenerators.size());
+    
+    buildFaceTemplates();
 }
 
-std::vector<BlockbenchInstanceGenerator::FaceInstance> ChunkMeshGenerator::generateChunkMesh(const Chunk& chunk) {
-    PROFILE_FUNCTION();
+void ChunkMeshGenerator::buildFaceTemplates() {
+    m_faceTemplates.assign(Blocks::getBlockCount(), BlockFaceTemplates{});
+    m_hasUndirectedFaces = false;
     
-    // Early exit for empty chunks
-    bool isEmpty = true;
-    for (int x = 0; x < Chunk::CHUNK_SIZE && isEmpty; ++x) {
-        for (int y = 0; y < Chunk::CHUNK_SIZE && isEmpty; ++y) {
-            for (int z = 0; z < Chunk::CHUNK_SIZE && isEmpty; ++z) {
-                if (chunk.getBlock(x, y, z) != Blocks::AIR) {
-                    isEmpty = false;
+    auto directionGroup = [](const BlockbenchInstanceGenerator::FaceInstance& face) {
+        return face.faceDirection >= 0 && face.faceDirection < 6
+            ? static_cast<uint32_t>(face.faceDirection) : BlockFaceTemplates::UNDIRECTED;
+    };
+    
+    for (const auto& [blockType, generator] : m_blockGenerators) {
+        if (blockType >= m_faceTemplates.size()) {
+            continue;
+        }
+        
+        BlockFaceTemplates& templates = m_faceTemplates[blockType];
+        const auto modelFaces = generator->generateInstancesAtPosition(glm::vec3(0.0f));
+        templates.renderLayer = Blocks::getRenderLayer(blockType);
+        templates.hasModel = true;
+        
+        // Bake the variants: mask m keeps the faces of the directions set in m
+        for (uint32_t mask = 0; mask < BlockFaceTemplates::VARIANT_COUNT; ++mask) {
+            templates.variantOffsets[mask] = static_cast<uint32_t>(templates.variantFaces.size());
+            for (const auto& face : modelFaces) {
+                const uint32_t group = directionGroup(face);
+                if (group == BlockFaceTemplates::UNDIRECTED || ((mask >> group) & 1u)) {
+                    templates.variantFaces.push_back(face);
+                    templates.variantFaces.back().renderLayer = templates.renderLayer;
                 }
             }
         }
+        templates.variantOffsets[BlockFaceTemplates::VARIANT_COUNT] =
+            static_cast<uint32_t>(templates.variantFaces.size());
+        
+        // Group by direction for the greedy mesher, which works one direction at a time
+        for (uint32_t group = 0; group <= BlockFaceTemplates::UNDIRECTED; ++group) {
+            templates.directionOffsets[group] = static_cast<uint32_t>(templates.faces.size());
+            for (const auto& face : modelFaces) {
+                if (directionGroup(face) == group) {
+                    templates.faces.push_back(face);
+                    templates.faces.back().renderLayer = templates.renderLayer;
+                }
+            }
+        }
+        templates.directionOffsets[BlockFaceTemplates::UNDIRECTED + 1] = static_cast<uint32_t>(templates.faces.size());
+        
+        templates.hasUndirectedFaces = !templates.getDirectionFaces(BlockFaceTemplates::UNDIRECTED).empty();
+        m_hasUndirectedFaces = m_hasUndirectedFaces || templates.hasUndirectedFaces;
+        
+        // Merging would drop any second face on the same side (inner elements, overlays)
+        for (uint32_t dir = 0; dir < 6; ++dir) {
+            const auto directionFaces = templates.getDirectionFaces(dir);
+            if (directionFaces.size() == 1 && isFullBlockFace(directionFaces.front())) {
+                templates.mergeableFace[dir] = static_cast<int>(templates.directionOffsets[dir]);
+            }
+        }
     }
+}
+
+template<typename FaceVector>
+void ChunkMeshGenerator::emitBlockFaces(const BlockFaceTemplates& templates, uint32_t visibleFaces,
+                                        const OccupancyMasks& occupancy, int x, int y, int z,
+                                        const glm::ivec3& chunkWorldPos, FaceVector& out) {
+    const glm::vec3 offset(chunkWorldPos + glm::ivec3(x, y, z));
+    for (const auto& faceTemplate : templates.getVariant(visibleFaces)) {
+        auto& face = out.emplace_back(faceTemplate);
+        face.position += offset;
+        face.ao = VoxelAO::calculateFaceAO(occupancy, x, y, z, face.faceDirection);
+    }
+}
+
+std::vector<BlockbenchInstanceGenerator::FaceInstance> ChunkMeshGenerator::generateChunkMesh(const Chunk& chunk) {
+    PROFILE_FUNCTION();
     
-    if (isEmpty) {
+    // Early exit for empty chunks
+    if (chunk.isEmpty()) {
         return {}; // Return empty vector for empty chunks
     }
     
@@ -138,18 +326,7 @@ FaceInstancePool::FaceInstanceBatch ChunkMeshGenerator::generateChunkMeshPooled(
     auto batch = m_faceInstancePool->acquireBatch();
     
     // Early exit for empty chunks
-    bool isEmpty = true;
-    for (int x = 0; x < Chunk::CHUNK_SIZE && isEmpty; ++x) {
-        for (int y = 0; y < Chunk::CHUNK_SIZE && isEmpty; ++y) {
-            for (int z = 0; z < Chunk::CHUNK_SIZE && isEmpty; ++z) {
-                if (chunk.getBlock(x, y, z) != Blocks::AIR) {
-                    isEmpty = false;
-                }
-            }
-        }
-    }
-    
-    if (isEmpty) {
+    if (chunk.isEmpty()) {
         return batch; // Return empty batch for empty chunks
     }
     
@@ -174,18 +351,7 @@ LayeredChunkMesh ChunkMeshGenerator::generateLayeredChunkMesh(const Chunk& chunk
     LayeredChunkMesh layeredMesh;
     
     // Early exit for empty chunks
-    bool isEmpty = true;
-    for (int x = 0; x < Chunk::CHUNK_SIZE && isEmpty; ++x) {
-        for (int y = 0; y < Chunk::CHUNK_SIZE && isEmpty; ++y) {
-            for (int z = 0; z < Chunk::CHUNK_SIZE && isEmpty; ++z) {
-                if (chunk.getBlock(x, y, z) != Blocks::AIR) {
-                    isEmpty = false;
-                }
-            }
-        }
-    }
-    
-    if (isEmpty) {
+    if (chunk.isEmpty()) {
         return layeredMesh; // Return empty layered mesh for empty chunks
     }
     
@@ -211,18 +377,7 @@ LayeredChunkMesh ChunkMeshGenerator::generateLayeredChunkMeshWithNeighbors(
     LayeredChunkMesh layeredMesh;
     
     // Early exit for empty chunks
-    bool isEmpty = true;
-    for (int x = 0; x < Chunk::CHUNK_SIZE && isEmpty; ++x) {
-        for (int y = 0; y < Chunk::CHUNK_SIZE && isEmpty; ++y) {
-            for (int z = 0; z < Chunk::CHUNK_SIZE && isEmpty; ++z) {
-                if (chunk.getBlock(x, y, z) != Blocks::AIR) {
-                    isEmpty = false;
-                }
-            }
-        }
-    }
-    
-    if (isEmpty) {
+    if (chunk.isEmpty()) {
         return layeredMesh; // Return empty layered mesh for empty chunks
     }
     
@@ -307,14 +462,8 @@ void ChunkMeshGenerator::generateBlockFacesLayered(const Chunk& chunk, int x, in
         }
         
         if (shouldRender) {
-            // Calculate ambient occlusion for this face (requires ChunkManager for cross-chunk support)
-            if (m_chunkManager) {
-                glm::ivec3 chunkWorldPos = chunk.getChunkPosition() * Chunk::CHUNK_SIZE;
-                face.ao = VoxelAO::calculateFaceAO(m_chunkManager, chunkWorldPos, x, y, z, face.faceDirection);
-            } else {
-                // No ChunkManager available - set default AO (no occlusion)
-                face.ao = glm::vec4(1.0f);
-            }
+            // AO is computed from the padded snapshot, which chunk-only meshing doesn't have
+            face.ao = glm::vec4(1.0f);
             
             // Set the render layer on the face
             face.renderLayer = renderLayer;
@@ -413,14 +562,8 @@ void ChunkMeshGenerator::generateBlockFacesLayeredWithNeighbors(const Chunk& chu
         }
         
         if (shouldRender) {
-            // Calculate ambient occlusion for this face (requires ChunkManager for cross-chunk support)
-            if (m_chunkManager) {
-                glm::ivec3 chunkWorldPos = chunk.getChunkPosition() * Chunk::CHUNK_SIZE;
-                face.ao = VoxelAO::calculateFaceAO(m_chunkManager, chunkWorldPos, x, y, z, face.faceDirection);
-            } else {
-                // No ChunkManager available - set default AO (no occlusion)
-                face.ao = glm::vec4(1.0f);
-            }
+            // AO is computed from the padded snapshot, which chunk-only meshing doesn't have
+            face.ao = glm::vec4(1.0f);
             
             // Set the render layer on the face
             face.renderLayer = renderLayer;
@@ -482,14 +625,8 @@ void ChunkMeshGenerator::generateBlockFaces(const Chunk& chunk, int x, int y, in
         }
         
         if (shouldRender) {
-            // Calculate ambient occlusion for this face (requires ChunkManager for cross-chunk support)
-            if (m_chunkManager) {
-                glm::ivec3 chunkWorldPos = chunk.getChunkPosition() * Chunk::CHUNK_SIZE;
-                face.ao = VoxelAO::calculateFaceAO(m_chunkManager, chunkWorldPos, x, y, z, face.faceDirection);
-            } else {
-                // No ChunkManager available - set default AO (no occlusion)
-                face.ao = glm::vec4(1.0f);
-            }
+            // AO is computed from the padded snapshot, which chunk-only meshing doesn't have
+            face.ao = glm::vec4(1.0f);
             faces.emplace_back(std::move(face));
         }
     }
@@ -751,18 +888,7 @@ std::vector<BlockbenchInstanceGenerator::FaceInstance> ChunkMeshGenerator::gener
     PROFILE_FUNCTION();
     
     // Early exit for empty chunks
-    bool isEmpty = true;
-    for (int x = 0; x < Chunk::CHUNK_SIZE && isEmpty; ++x) {
-        for (int y = 0; y < Chunk::CHUNK_SIZE && isEmpty; ++y) {
-            for (int z = 0; z < Chunk::CHUNK_SIZE && isEmpty; ++z) {
-                if (chunk.getBlock(x, y, z) != Blocks::AIR) {
-                    isEmpty = false;
-                }
-            }
-        }
-    }
-    
-    if (isEmpty) {
+    if (chunk.isEmpty()) {
         return {}; // Return empty vector for empty chunks
     }
     
@@ -824,18 +950,7 @@ FaceInstancePool::FaceInstanceBatch ChunkMeshGenerator::generateChunkMeshPooledW
     auto batch = m_faceInstancePool->acquireBatch();
     
     // Early exit for empty chunks
-    bool isEmpty = true;
-    for (int x = 0; x < Chunk::CHUNK_SIZE && isEmpty; ++x) {
-        for (int y = 0; y < Chunk::CHUNK_SIZE && isEmpty; ++y) {
-            for (int z = 0; z < Chunk::CHUNK_SIZE && isEmpty; ++z) {
-                if (chunk.getBlock(x, y, z) != Blocks::AIR) {
-                    isEmpty = false;
-                }
-            }
-        }
-    }
-    
-    if (isEmpty) {
+    if (chunk.isEmpty()) {
         return batch; // Return empty batch for empty chunks
     }
     
@@ -930,14 +1045,8 @@ void ChunkMeshGenerator::generateBlockFacesWithNeighbors(const Chunk& chunk, int
         }
         
         if (shouldRender) {
-            // Calculate ambient occlusion for this face (requires ChunkManager for cross-chunk support)
-            if (m_chunkManager) {
-                glm::ivec3 chunkWorldPos = chunk.getChunkPosition() * Chunk::CHUNK_SIZE;
-                face.ao = VoxelAO::calculateFaceAO(m_chunkManager, chunkWorldPos, x, y, z, face.faceDirection);
-            } else {
-                // No ChunkManager available - set default AO (no occlusion)
-                face.ao = glm::vec4(1.0f);
-            }
+            // AO is computed from the padded snapshot, which chunk-only meshing doesn't have
+            face.ao = glm::vec4(1.0f);
             faces.emplace_back(std::move(face));
         }
     }
@@ -1023,174 +1132,426 @@ void ChunkMeshGenerator::generateBlockFacesPooledWithNeighbors(const Chunk& chun
     }
 }
 
-std::vector<BlockbenchInstanceGenerator::FaceInstance> ChunkMeshGenerator::generateChunkMeshExtended(
-    const Chunk& chunk,
-    const std::array<BlockType, 18*18*18>& extendedBlockData) {
+LayeredChunkMesh ChunkMeshGenerator::generateChunkMeshExtended(const ChunkNeighborhood& neighborhood) const {
+    return generateChunkMeshExtended(ExtendedChunkData(neighborhood));
+}
+
+LayeredChunkMesh ChunkMeshGenerator::generateChunkMeshExtended(const ExtendedChunkData& extendedData) const {
+    return m_binaryMeshingEnabled ? generateChunkMeshGreedy(extendedData) : generateChunkMeshPerBlock(extendedData);
+}
+
+LayeredChunkMesh ChunkMeshGenerator::generateChunkMeshExtended(const ExtendedChunkData& extendedData,
+                                                               const OccupancyMasks& occupancy,
+                                                               const FaceVisibilityMask& visibilityMask,
+                                                               std::pmr::memory_resource* resource) const {
+    return m_binaryMeshingEnabled ? generateChunkMeshGreedy(extendedData, occupancy, visibilityMask, resource)
+                                  : generateChunkMeshPerBlock(extendedData, occupancy, visibilityMask, resource);
+}
+
+uint64_t ChunkMeshGenerator::computeMeshInputHash(const ExtendedChunkData& extendedData,
+                                                  const OccupancyMasks& occupancy,
+                                                  const FaceVisibilityMask& visibilityMask) const {
     PROFILE_FUNCTION();
     
-    // Create extended chunk data from pre-sampled 18x18x18 data
-    ExtendedChunkData extendedData(extendedBlockData, chunk.getChunkPosition());
+    ContentHash hash;
+    hash.add(m_binaryMeshingEnabled ? 1 : 0);
+    hash.add(VoxelAO::getSettingsHash());
     
-    // Early exit for empty chunks
-    bool isEmpty = true;
-    for (int x = 0; x < Chunk::CHUNK_SIZE && isEmpty; ++x) {
-        for (int y = 0; y < Chunk::CHUNK_SIZE && isEmpty; ++y) {
-            for (int z = 0; z < Chunk::CHUNK_SIZE && isEmpty; ++z) {
-                if (chunk.getBlock(x, y, z) != Blocks::AIR) {
-                    isEmpty = false;
+    for (int dir = 0; dir < 6; ++dir) {
+        hash.add(visibilityMask.getFaceMask(static_cast<FaceVisibilityMask::FaceDirection>(dir)));
+    }
+    
+    // Occluders anywhere in the padded region may darken a visible face's corners
+    for (int z = -ExtendedChunkData::BORDER_SIZE; z <= Chunk::CHUNK_SIZE; ++z) {
+        for (int y = -ExtendedChunkData::BORDER_SIZE; y < Chunk::CHUNK_SIZE; y += 2) {
+            hash.add(uint64_t{occupancy.getRow(OccupancyMasks::AO_OCCLUDER, y, z)} << 32 |
+                     occupancy.getRow(OccupancyMasks::AO_OCCLUDER, y + 1, z));
+        }
+    }
+    
+    // Block types behind the visible faces, in mask order; hidden blocks can change freely
+    for (int z = 0; z < Chunk::CHUNK_SIZE; ++z) {
+        for (int y = 0; y < Chunk::CHUNK_SIZE; ++y) {
+            uint32_t visibleRow = 0;
+            for (int dir = 0; dir < 6; ++dir) {
+                visibleRow |= visibilityMask.getRowVisible(y, z, static_cast<FaceVisibilityMask::FaceDirection>(dir));
+            }
+            for (uint32_t bits = visibleRow; bits != 0; bits &= bits - 1) {
+                hash.add(extendedData.getBlock(std::countr_zero(bits), y, z));
+            }
+        }
+    }
+    
+    // Faces without a direction are emitted whether or not the block is visible
+    if (m_hasUndirectedFaces) {
+        for (int z = 0; z < Chunk::CHUNK_SIZE; ++z) {
+            for (int y = 0; y < Chunk::CHUNK_SIZE; ++y) {
+                for (int x = 0; x < Chunk::CHUNK_SIZE; ++x) {
+                    const BlockType type = extendedData.getBlock(x, y, z);
+                    if (type < m_faceTemplates.size() && m_faceTemplates[type].hasUndirectedFaces) {
+                        hash.add(static_cast<uint64_t>(x | y << 4 | z << 8) << 16 | type);
+                    }
                 }
             }
         }
     }
     
-    if (isEmpty) {
-        return {}; // Return empty vector for empty chunks
+    return hash.finish();
+}
+
+LayeredChunkMesh ChunkMeshGenerator::generateChunkMeshPerBlock(const ExtendedChunkData& extendedData) const {
+    // Early exit for empty chunks
+    if (extendedData.isCenterEmpty()) {
+        return {};
     }
     
-    std::vector<BlockbenchInstanceGenerator::FaceInstance> allFaces;
+    // Cull every face of the chunk up front with the bitwise kernel; the same
+    // occupancy masks feed ambient occlusion
+    const OccupancyMasks occupancy(extendedData);
+    const FaceVisibilityMask visibilityMask = FaceVisibilityMaskGenerator::generateMask(extendedData, occupancy);
+    return generateChunkMeshPerBlock(extendedData, occupancy, visibilityMask, std::pmr::get_default_resource());
+}
+
+LayeredChunkMesh ChunkMeshGenerator::generateChunkMeshPerBlock(const ExtendedChunkData& extendedData,
+                                                               const OccupancyMasks& occupancy,
+                                                               const FaceVisibilityMask& visibilityMask,
+                                                               std::pmr::memory_resource* resource) const {
+    PROFILE_FUNCTION();
+    
+    LayeredChunkMesh layeredMesh(resource);
+    
+    // Early exit for empty chunks
+    if (extendedData.isCenterEmpty()) {
+        return layeredMesh; // Return empty layered mesh for empty chunks
+    }
     
     // Calculate world position once
-    glm::ivec3 chunkWorldPos = chunk.getChunkPosition() * Chunk::CHUNK_SIZE;
+    glm::ivec3 chunkWorldPos = extendedData.getChunkPosition() * Chunk::CHUNK_SIZE;
     
     // Iterate through all blocks in the chunk
     for (int x = 0; x < Chunk::CHUNK_SIZE; ++x) {
         for (int y = 0; y < Chunk::CHUNK_SIZE; ++y) {
             for (int z = 0; z < Chunk::CHUNK_SIZE; ++z) {
-                generateBlockFacesExtended(extendedData, x, y, z, allFaces, chunkWorldPos);
+                generateBlockFacesExtended(extendedData, x, y, z, visibilityMask, occupancy, layeredMesh, chunkWorldPos);
             }
         }
     }
     
-    return allFaces;
+    return layeredMesh;
 }
 
 void ChunkMeshGenerator::generateBlockFacesExtended(const ExtendedChunkData& extendedData, int x, int y, int z,
-                                                   std::vector<BlockbenchInstanceGenerator::FaceInstance>& faces,
-                                                   const glm::ivec3& chunkWorldPos) {
+                                                   const FaceVisibilityMask& visibilityMask,
+                                                   const OccupancyMasks& occupancy,
+                                                   LayeredChunkMesh& layeredMesh,
+                                                   const glm::ivec3& chunkWorldPos) const {
     BlockType blockType = extendedData.getBlock(x, y, z);
     
-    // Skip air blocks
-    if (blockType == Blocks::AIR) {
+    // Skip air and blocks without a model
+    if (blockType == Blocks::AIR || blockType >= m_faceTemplates.size() || !m_faceTemplates[blockType].hasModel) {
         return;
     }
     
-    // Find the generator for this block type
-    auto it = m_blockGenerators.find(blockType);
-    if (it == m_blockGenerators.end()) {
-        return; // No model for this block type
+    // Face culling is one lookup: the variant for the block's visible faces in the pre-computed mask
+    const BlockFaceTemplates& templates = m_faceTemplates[blockType];
+    emitBlockFaces(templates, visibilityMask.getVisibleFaces(x, y, z), occupancy, x, y, z, chunkWorldPos,
+                   layeredMesh.getLayer(templates.renderLayer));
+}
+
+LayeredChunkMesh ChunkMeshGenerator::generateChunkMeshGreedy(const ExtendedChunkData& extendedData) const {
+    // Early exit for empty chunks
+    if (extendedData.isCenterEmpty()) {
+        return {};
     }
     
-    // Calculate world position of this block
-    glm::vec3 blockWorldPos = glm::vec3(chunkWorldPos) + glm::vec3(x, y, z);
+    const OccupancyMasks occupancy(extendedData);
+    const FaceVisibilityMask visibilityMask = FaceVisibilityMaskGenerator::generateMask(extendedData, occupancy);
+    return generateChunkMeshGreedy(extendedData, occupancy, visibilityMask, std::pmr::get_default_resource());
+}
+
+LayeredChunkMesh ChunkMeshGenerator::generateChunkMeshGreedy(const ExtendedChunkData& extendedData,
+                                                             const OccupancyMasks& occupancy,
+                                                             const FaceVisibilityMask& visibilityMask,
+                                                             std::pmr::memory_resource* resource) const {
+    PROFILE_FUNCTION();
     
-    // Generate faces at this position
-    auto blockFaces = it->second->generateInstancesAtPosition(blockWorldPos);
+    LayeredChunkMesh layeredMesh(resource);
     
-    // Face culling: only add faces that are visible using extended data
-    for (auto&& face : blockFaces) {
-        bool shouldRender = false;
+    // Early exit for empty chunks
+    if (extendedData.isCenterEmpty()) {
+        return layeredMesh;
+    }
+    
+    std::array<uint16_t, 6> allSlices;
+    allSlices.fill(0xFFFF);
+    generateGreedySlices(extendedData, occupancy, visibilityMask, allSlices, layeredMesh);
+    generateUndirectedFaces(extendedData, occupancy, layeredMesh);
+    return layeredMesh;
+}
+
+void ChunkMeshGenerator::generateGreedySlices(const ExtendedChunkData& extendedData,
+                                              const OccupancyMasks& occupancy,
+                                              const FaceVisibilityMask& visibilityMask,
+                                              const std::array<uint16_t, 6>& slices,
+                                              LayeredChunkMesh& layeredMesh) const {
+    const glm::ivec3 chunkWorldPos = extendedData.getChunkPosition() * Chunk::CHUNK_SIZE;
+    layeredMesh.sliceCounts.assign(RENDER_LAYER_COUNT * ChunkMesh::GROUPS_PER_LAYER, 0);
+    
+    GreedyScratch& scratch = getGreedyScratch();
+    if (scratch.slotOfType.size() < m_faceTemplates.size()) {
+        scratch.slotOfType.resize(m_faceTemplates.size(), NO_SLOT);
+    }
+    
+    auto emitFace = [&](const BlockbenchInstanceGenerator::FaceInstance& faceTemplate, RenderLayer renderLayer,
+                        const glm::ivec3& cell, const glm::vec4& ao) -> BlockbenchInstanceGenerator::FaceInstance& {
+        auto& face = layeredMesh.getLayer(renderLayer).emplace_back(faceTemplate);
+        face.position += glm::vec3(chunkWorldPos + cell);
+        face.renderLayer = renderLayer;
+        face.ao = ao;
+        return face;
+    };
+    
+    for (int dir = 0; dir < 6; ++dir) {
+        const auto direction = static_cast<FaceVisibilityMask::FaceDirection>(dir);
+        const SliceAxes& axes = SLICE_AXES[dir];
+        if (slices[dir] == 0) {
+            continue;
+        }
         
-        // Check visibility based on face direction using extended data
-        switch (face.faceDirection) {
-            case 0: // Down face (Y-)
-                shouldRender = extendedData.isFaceVisible(x, y, z, 0, -1, 0);
-                break;
-            case 1: // Up face (Y+)
-                shouldRender = extendedData.isFaceVisible(x, y, z, 0, 1, 0);
-                break;
-            case 2: // North face (Z-)
-                shouldRender = extendedData.isFaceVisible(x, y, z, 0, 0, -1);
-                break;
-            case 3: // South face (Z+)
-                shouldRender = extendedData.isFaceVisible(x, y, z, 0, 0, 1);
-                break;
-            case 4: // West face (X-)
-                shouldRender = extendedData.isFaceVisible(x, y, z, -1, 0, 0);
-                break;
-            case 5: // East face (X+)
-                shouldRender = extendedData.isFaceVisible(x, y, z, 1, 0, 0);
-                break;
-            default:
-                shouldRender = true; // Render unknown faces by default
-                break;
+        // AO of this direction's faces, a whole X row at a time. Slices across X
+        // need every row, slices across Y or Z only the rows they contain
+        std::array<VoxelAO::RowAO, Chunk::CHUNK_SIZE * Chunk::CHUNK_SIZE> rowAO;
+        for (int z = 0; z < Chunk::CHUNK_SIZE; ++z) {
+            for (int y = 0; y < Chunk::CHUNK_SIZE; ++y) {
+                const int rowSlice = axes.sliceAxis == 1 ? y : z;
+                const bool inSlices = axes.sliceAxis == 0 || ((slices[dir] >> rowSlice) & 1u);
+                if (inSlices && visibilityMask.getRowVisible(y, z, direction) != 0) {
+                    rowAO[y + z * Chunk::CHUNK_SIZE] = VoxelAO::calculateRowAO(occupancy, y, z, dir);
+                }
+            }
         }
         
-        if (shouldRender) {
-            // Calculate ambient occlusion for this face
-            if (m_chunkManager) {
-                face.ao = VoxelAO::calculateFaceAO(m_chunkManager, chunkWorldPos, x, y, z, face.faceDirection);
-            } else {
-                // No ChunkManager available - set default AO (no occlusion)
-                face.ao = glm::vec4(1.0f);
+        for (int slice = 0; slice < Chunk::CHUNK_SIZE; ++slice) {
+            if (!((slices[dir] >> slice) & 1u)) {
+                continue;
+            }
+            
+            std::array<size_t, RENDER_LAYER_COUNT> layerStart;
+            for (size_t layer = 0; layer < RENDER_LAYER_COUNT; ++layer) {
+                layerStart[layer] = layeredMesh.layers[layer].size();
+            }
+            
+            const SliceRows visibleRows = getVisibleSliceRows(visibilityMask, direction, axes, slice);
+            
+            // Sort the slice's visible faces into rows per (block type, AO level);
+            // faces that can't merge are emitted right away
+            for (int row = 0; row < Chunk::CHUNK_SIZE; ++row) {
+                for (uint32_t bits = visibleRows[row]; bits != 0; bits &= bits - 1) {
+                    const int bit = std::countr_zero(bits);
+                    const glm::ivec3 cell = axes.toCell(slice, row, bit);
+                    const BlockType type = extendedData.getBlock(cell.x, cell.y, cell.z);
+                    if (type >= m_faceTemplates.size() || !m_faceTemplates[type].hasModel) {
+                        continue; // No model for this block type
+                    }
+                    
+                    const BlockFaceTemplates& templates = m_faceTemplates[type];
+                    const glm::vec4 ao = VoxelAO::getFaceAO(rowAO[cell.y + cell.z * Chunk::CHUNK_SIZE], cell.x);
+                    
+                    // All four corners must share one AO level, or the merged quad would
+                    // stretch this face's gradient across its neighbors
+                    const uint32_t aoLevel = PackedFace::aoLevel(ao.x);
+                    const bool uniformAO = PackedFace::aoLevel(ao.y) == aoLevel &&
+                                           PackedFace::aoLevel(ao.z) == aoLevel &&
+                                           PackedFace::aoLevel(ao.w) == aoLevel;
+                    if (templates.mergeableFace[dir] < 0 || !uniformAO) {
+                        for (const auto& face : templates.getDirectionFaces(dir)) {
+                            emitFace(face, templates.renderLayer, cell, ao);
+                        }
+                        continue;
+                    }
+                    
+                    uint16_t& slot = scratch.slotOfType[type];
+                    if (slot == NO_SLOT) {
+                        slot = static_cast<uint16_t>(scratch.palette.size());
+                        scratch.palette.push_back(type);
+                        if (scratch.keyRows.size() < scratch.palette.size() * AO_LEVELS) {
+                            scratch.keyRows.resize(scratch.palette.size() * AO_LEVELS, SliceRows{});
+                            scratch.keyTouched.resize(scratch.palette.size() * AO_LEVELS, 0);
+                        }
+                    }
+                    
+                    const uint32_t key = slot * AO_LEVELS + aoLevel;
+                    if (!scratch.keyTouched[key]) {
+                        scratch.keyTouched[key] = 1;
+                        scratch.touchedKeys.push_back(key);
+                    }
+                    scratch.keyRows[key][row] |= static_cast<uint16_t>(1u << bit);
+                }
+            }
+            
+            for (uint32_t key : scratch.touchedKeys) {
+                const BlockFaceTemplates& templates = m_faceTemplates[scratch.palette[key / AO_LEVELS]];
+                const auto& faceTemplate = templates.faces[templates.mergeableFace[dir]];
+                const glm::vec4 ao(static_cast<float>(key % AO_LEVELS) / static_cast<float>(AO_LEVELS - 1));
+                
+                mergeSliceRows(scratch.keyRows[key], [&](int start, int row, int width, int height) {
+                    // The quad grows from the corner its U and V axes point away from
+                    const int originBit = axes.bitPositive ? start : start + width - 1;
+                    const int originRow = axes.rowPositive ? row : row + height - 1;
+                    auto& face = emitFace(faceTemplate, templates.renderLayer,
+                                          axes.toCell(slice, originRow, originBit), ao);
+                    face.scale.x *= static_cast<float>(width);
+                    face.scale.y *= static_cast<float>(height);
+                    face.uv.z = face.uv.x + (face.uv.z - face.uv.x) * static_cast<float>(width);
+                    face.uv.w = face.uv.y + (face.uv.w - face.uv.y) * static_cast<float>(height);
+                });
+                scratch.keyTouched[key] = 0;
+            }
+            scratch.touchedKeys.clear();
+            
+            for (size_t layer = 0; layer < RENDER_LAYER_COUNT; ++layer) {
+                layeredMesh.sliceCounts[ChunkMesh::getSliceGroup(layer, dir, slice)] =
+                    static_cast<uint32_t>(layeredMesh.layers[layer].size() - layerStart[layer]);
             }
-            faces.emplace_back(std::move(face));
         }
     }
+    
+    // Hand the palette slots back for the next chunk meshed on this thread
+    for (BlockType type : scratch.palette) {
+        scratch.slotOfType[type] = NO_SLOT;
+    }
+    scratch.palette.clear();
 }
 
-void ChunkMeshGenerator::generateBlockFacesWithMask(const ExtendedChunkData& extendedData, int x, int y, int z,
-                                                   const FaceVisibilityMask& visibilityMask,
-                                                   std::vector<BlockbenchInstanceGenerator::FaceInstance>& faces,
-                                                   const glm::ivec3& chunkWorldPos) {
-    BlockType blockType = extendedData.getBlock(x, y, z);
-    
-    // Skip air blocks
-    if (blockType == Blocks::AIR) {
+void ChunkMeshGenerator::generateUndirectedFaces(const ExtendedChunkData& extendedData,
+                                                 const OccupancyMasks& occupancy,
+                                                 LayeredChunkMesh& layeredMesh) const {
+    if (!m_hasUndirectedFaces) {
         return;
     }
     
-    // Find the generator for this block type
-    auto it = m_blockGenerators.find(blockType);
-    if (it == m_blockGenerators.end()) {
-        return; // No model for this block type
+    const glm::ivec3 chunkWorldPos = extendedData.getChunkPosition() * Chunk::CHUNK_SIZE;
+    std::array<size_t, RENDER_LAYER_COUNT> layerStart;
+    for (size_t layer = 0; layer < RENDER_LAYER_COUNT; ++layer) {
+        layerStart[layer] = layeredMesh.layers[layer].size();
     }
     
-    // Calculate world position of this block
-    glm::vec3 blockWorldPos = glm::vec3(chunkWorldPos) + glm::vec3(x, y, z);
+    // Faces without a direction are never culled
+    for (int z = 0; z < Chunk::CHUNK_SIZE; ++z) {
+        for (int y = 0; y < Chunk::CHUNK_SIZE; ++y) {
+            for (int x = 0; x < Chunk::CHUNK_SIZE; ++x) {
+                const BlockType type = extendedData.getBlock(x, y, z);
+                if (type >= m_faceTemplates.size() || !m_faceTemplates[type].hasModel) {
+                    continue;
+                }
+                const BlockFaceTemplates& templates = m_faceTemplates[type];
+                if (templates.hasUndirectedFaces) {
+                    emitBlockFaces(templates, 0, occupancy, x, y, z, chunkWorldPos,
+                                   layeredMesh.getLayer(templates.renderLayer));
+                }
+            }
+        }
+    }
     
-    // Generate faces at this position
-    auto blockFaces = it->second->generateInstancesAtPosition(blockWorldPos);
+    for (size_t layer = 0; layer < RENDER_LAYER_COUNT; ++layer) {
+        layeredMesh.sliceCounts[layer * ChunkMesh::GROUPS_PER_LAYER + ChunkMesh::UNDIRECTED_GROUP] =
+            static_cast<uint32_t>(layeredMesh.layers[layer].size() - layerStart[layer]);
+    }
+}
+
+std::optional<ChunkMesh> ChunkMeshGenerator::generateChunkMeshIncremental(const ExtendedChunkData& extendedData,
+                                                                          const OccupancyMasks& occupancy,
+                                                                          const FaceVisibilityMask& visibilityMask,
+                                                                          const ChunkMesh& previous,
+                                                                          const ChunkSliceMask& dirtySlices) const {
+    PROFILE_FUNCTION();
     
-    // Face culling: only add faces that are visible using pre-computed mask
-    for (auto&& face : blockFaces) {
-        bool shouldRender = false;
-        
-        // Check visibility using the pre-computed mask (O(1) bit lookup)
-        switch (face.faceDirection) {
-            case 0: // Down face (Y-)
-                shouldRender = visibilityMask.isFaceVisible(x, y, z, FaceVisibilityMask::FaceDirection::DOWN);
-                break;
-            case 1: // Up face (Y+)
-                shouldRender = visibilityMask.isFaceVisible(x, y, z, FaceVisibilityMask::FaceDirection::UP);
-                break;
-            case 2: // North face (Z-)
-                shouldRender = visibilityMask.isFaceVisible(x, y, z, FaceVisibilityMask::FaceDirection::NORTH);
-                break;
-            case 3: // South face (Z+)
-                shouldRender = visibilityMask.isFaceVisible(x, y, z, FaceVisibilityMask::FaceDirection::SOUTH);
-                break;
-            case 4: // West face (X-)
-                shouldRender = visibilityMask.isFaceVisible(x, y, z, FaceVisibilityMask::FaceDirection::WEST);
-                break;
-            case 5: // East face (X+)
-                shouldRender = visibilityMask.isFaceVisible(x, y, z, FaceVisibilityMask::FaceDirection::EAST);
-                break;
-            default:
-                shouldRender = true; // Render unknown faces by default
-                break;
-        }
-        
-        if (shouldRender) {
-            // Calculate ambient occlusion for this face
-            if (m_chunkManager) {
-                face.ao = VoxelAO::calculateFaceAO(m_chunkManager, chunkWorldPos, x, y, z, face.faceDirection);
+    if (!m_binaryMeshingEnabled || previous.sliceCounts.size() != RENDER_LAYER_COUNT * ChunkMesh::GROUPS_PER_LAYER) {
+        return std::nullopt;
+    }
+    
+    // A direction's slices lie along its normal axis
+    std::array<uint16_t, 6> slices;
+    for (int dir = 0; dir < 6; ++dir) {
+        slices[dir] = dirtySlices[SLICE_AXES[dir].sliceAxis];
+    }
+    
+    // Undirected faces are cheap and not grouped by slice, so they are always rebuilt.
+    // Only the spliced mesh outlives this call
+    ScratchArena::Scope scratch;
+    LayeredChunkMesh rebuilt(scratch.resource());
+    generateGreedySlices(extendedData, occupancy, visibilityMask, slices, rebuilt);
+    generateUndirectedFaces(extendedData, occupancy, rebuilt);
+    
+    const glm::ivec3 chunkOrigin = extendedData.getChunkPosition() * Chunk::CHUNK_SIZE;
+    ChunkMesh mesh;
+    mesh.sliceCounts.resize(previous.sliceCounts.size());
+    mesh.faces.reserve(previous.faces.size());
+    
+    // Walk both meshes group by group, taking each group from one of them
+    size_t previousOffset = 0;
+    for (size_t layer = 0; layer < RENDER_LAYER_COUNT; ++layer) {
+        const auto& rebuiltFaces = rebuilt.layers[layer];
+        size_t rebuiltOffset = 0;
+        for (size_t group = 0; group < ChunkMesh::GROUPS_PER_LAYER; ++group) {
+            const size_t index = layer * ChunkMesh::GROUPS_PER_LAYER + group;
+            const uint32_t previousCount = previous.sliceCounts[index];
+            const bool isRebuilt = group == ChunkMesh::UNDIRECTED_GROUP ||
+                ((slices[group / Chunk::CHUNK_SIZE] >> (group % Chunk::CHUNK_SIZE)) & 1u);
+            
+            uint32_t count = previousCount;
+            if (isRebuilt) {
+                count = rebuilt.sliceCounts[index];
+                for (uint32_t i = 0; i < count; ++i) {
+                    mesh.faces.push_back(PackedFace::pack(rebuiltFaces[rebuiltOffset + i], chunkOrigin));
+                }
+                rebuiltOffset += count;
             } else {
-                // No ChunkManager available - set default AO (no occlusion)
-                face.ao = glm::vec4(1.0f);
+                const auto first = previous.faces.begin() + static_cast<std::ptrdiff_t>(previousOffset);
+                mesh.faces.insert(mesh.faces.end(), first, first + previousCount);
             }
-            faces.emplace_back(std::move(face));
+            
+            previousOffset += previousCount;
+            mesh.sliceCounts[index] = count;
+            mesh.layerCounts[layer] += count;
         }
     }
+    
+    // Same shape as LayeredChunkMesh::pack, which drops the counts of empty meshes
+    if (mesh.faces.empty()) {
+        mesh.sliceCounts.clear();
+    }
+    return mesh;
+}
+
+ChunkSliceMask ChunkMeshGenerator::getSlicesAround(const glm::ivec3& blockPos) {
+    ChunkSliceMask slices{};
+    for (int axis = 0; axis < 3; ++axis) {
+        const int first = std::max(blockPos[axis] - 1, 0);
+        const int last = std::min(blockPos[axis] + 1, Chunk::CHUNK_SIZE - 1);
+        for (int slice = first; slice <= last; ++slice) {
+            slices[axis] |= static_cast<uint16_t>(1u << slice);
+        }
+    }
+    return slices;
+}
+
+
+void ChunkMeshGenerator::generateBlockFacesWithMask(const ExtendedChunkData& extendedData, int x, int y, int z,
+                                                   const FaceVisibilityMask& visibilityMask,
+                                                   const OccupancyMasks& occupancy,
+                                                   std::vector<BlockbenchInstanceGenerator::FaceInstance>& faces,
+                                                   const glm::ivec3& chunkWorldPos) {
+    BlockType blockType = extendedData.getBlock(x, y, z);
+    
+    // Skip air and blocks without a model
+    if (blockType == Blocks::AIR || blockType >= m_faceTemplates.size() || !m_faceTemplates[blockType].hasModel) {
+        return;
+    }
+    
+    // Pre-baked variant for the block's visible faces in the pre-computed mask
+    emitBlockFaces(m_faceTemplates[blockType], visibilityMask.getVisibleFaces(x, y, z), occupancy, x, y, z,
+                   chunkWorldPos, faces);
 }
 
 std::vector<BlockbenchInstanceGenerator::FaceInstance> ChunkMeshGenerator::generateChunkMeshWithVisibilityMask(
@@ -1199,7 +1560,8 @@ std::vector<BlockbenchInstanceGenerator::FaceInstance> ChunkMeshGenerator::gener
     PROFILE_FUNCTION();
     
     // Generate the face visibility mask once for the entire chunk
-    FaceVisibilityMask visibilityMask = FaceVisibilityMaskGenerator::generateMask(extendedData);
+    const OccupancyMasks occupancy(extendedData);
+    FaceVisibilityMask visibilityMask = FaceVisibilityMaskGenerator::generateMask(extendedData, occupancy);
     
     LOG_TRACE("Generated visibility mask with %zu visible faces for chunk (%d, %d, %d)", 
              visibilityMask.getTotalVisibleFaces(), chunkWorldPos.x, chunkWorldPos.y, chunkWorldPos.z);
@@ -1219,7 +1581,7 @@ std::vector<BlockbenchInstanceGenerator::FaceInstance> ChunkMeshGenerator::gener
         for (int y = 0; y < Chunk::CHUNK_SIZE; ++y) {
             for (int x = 0; x < Chunk::CHUNK_SIZE; ++x) {
                 // Use the optimized mask-based face generation
-                generateBlockFacesWithMask(extendedData, x, y, z, visibilityMask, allFaces, chunkWorldPos);
+                generateBlockFacesWithMask(extendedData, x, y, z, visibilityMask, occupancy, allFaces, chunkWorldPos);
             }
         }
     }
@@ -0,0 +1,176 @@
+#include "face_arena.h"
+#include "logger.h"
+#include <algorithm>
+#include <unordered_set>
+
+namespace Zerith {
+
+uint32_t FaceArena::slabCapacityFor(uint32_t faceCount) {
+    if (faceCount == 0) {
+        return 0;
+    }
+    uint32_t withHeadroom = faceCount + faceCount / 8;
+    return (withHeadroom + SLAB_GRANULARITY - 1) / SLAB_GRANULARITY * SLAB_GRANULARITY;
+}
+
+void FaceArena::update(const glm::ivec3& chunkPos, ChunkMeshSnapshot mesh) {
+    const uint32_t count = mesh ? static_cast<uint32_t>(mesh->faces.size()) : 0;
+    Slab& slab = m_slabs[chunkPos];
+    m_faceCount -= slab.count;
+    if (slab.mesh) {
+        m_faceBytes -= slab.mesh->faces.capacity() * sizeof(PackedFace);
+    }
+
+    // Overwrite in place unless the mesh outgrew the slab or shrank to a small part of it
+    bool fits = count <= slab.capacity && count * 4 >= slab.capacity;
+    if (!fits) {
+        if (slab.capacity > 0) {
+            release(slab.offset, slab.capacity);
+        }
+        slab.capacity = slabCapacityFor(count);
+        slab.offset = slab.capacity > 0 ? allocate(slab.capacity) : 0;
+    }
+
+    slab.count = count;
+    slab.mesh = std::move(mesh);
+    m_faceCount += count;
+    if (slab.mesh) {
+        m_faceBytes += slab.mesh->faces.capacity() * sizeof(PackedFace);
+    }
+    if (count > 0) {
+        m_pendingUploads.push_back({chunkPos, slab.offset, slab.mesh});
+    }
+    m_version++;
+}
+
+bool FaceArena::remove(const glm::ivec3& chunkPos) {
+    auto it = m_slabs.find(chunkPos);
+    if (it == m_slabs.end()) {
+        return false;
+    }
+    if (it->second.capacity > 0) {
+        release(it->second.offset, it->second.capacity);
+    }
+    m_faceCount -= it->second.count;
+    if (it->second.mesh) {
+        m_faceBytes -= it->second.mesh->faces.capacity() * sizeof(PackedFace);
+    }
+    m_slabs.erase(it);
+    m_version++;
+    return true;
+}
+
+void FaceArena::clear() {
+    m_slabs.clear();
+    m_freeByOffset.clear();
+    m_freeBySize.clear();
+    m_pendingUploads.clear();
+    m_top = 0;
+    m_faceCount = 0;
+    m_faceBytes = 0;
+    m_reservedSlots = 0;
+    m_version++;
+}
+
+std::span<const PackedFace> FaceArena::getFaces(const glm::ivec3& chunkPos) const {
+    auto it = m_slabs.find(chunkPos);
+    if (it == m_slabs.end() || !it->second.mesh) {
+        return {};
+    }
+    return std::span<const PackedFace>(it->second.mesh->faces);
+}
+
+ChunkMeshSnapshot FaceArena::getMesh(const glm::ivec3& chunkPos) const {
+    auto it = m_slabs.find(chunkPos);
+    return it != m_slabs.end() ? it->second.mesh : nullptr;
+}
+
+std::vector<FaceArena::Upload> FaceArena::takePendingUploads() {
+    // Live slabs don't overlap, so keeping only uploads that match their chunk's
+    // current slab leaves a set of disjoint writes
+    std::vector<Upload> uploads;
+    uploads.reserve(m_pendingUploads.size());
+    std::unordered_set<glm::ivec3> taken;
+    for (auto& upload : m_pendingUploads) {
+        auto it = m_slabs.find(upload.chunkPos);
+        if (it == m_slabs.end() || it->second.mesh != upload.mesh || it->second.offset != upload.offset) {
+            continue;
+        }
+        // The same snapshot may have been stored twice; upload it once
+        if (taken.insert(upload.chunkPos).second) {
+            uploads.push_back(std::move(upload));
+        }
+    }
+    m_pendingUploads.clear();
+    return uploads;
+}
+
+uint32_t FaceArena::allocate(uint32_t capacity) {
+    m_reservedSlots += capacity;
+
+    // Best fit among the free blocks, splitting off the remainder
+    auto fit = m_freeBySize.lower_bound(capacity);
+    if (fit != m_freeBySize.end()) {
+        uint32_t offset = fit->second;
+        uint32_t size = fit->first;
+        eraseFreeBlock(m_freeByOffset.find(offset));
+        if (size > capacity) {
+            insertFreeBlock(offset + capacity, size - capacity);
+        }
+        return offset;
+    }
+
+    // Otherwise take it from the top, growing the slot space if needed
+    uint32_t offset = m_top;
+    m_top += capacity;
+    if (m_top > m_capacity) {
+        m_capacity = std::max({MIN_CAPACITY, m_capacity * 2, m_top});
+        LOG_DEBUG("FaceArena: grew to %u face slots", m_capacity);
+    }
+    return offset;
+}
+
+void FaceArena::release(uint32_t offset, uint32_t capacity) {
+    m_reservedSlots -= capacity;
+
+    // Coalesce with the neighbouring free blocks
+    auto next = m_freeByOffset.lower_bound(offset);
+    if (next != m_freeByOffset.end() && next->first == offset + capacity) {
+        capacity += next->second;
+        eraseFreeBlock(next);
+    }
+    auto prev = m_freeByOffset.lower_bound(offset);
+    if (prev != m_freeByOffset.begin()) {
+        --prev;
+        if (prev->first + prev->second == offset) {
+            offset = prev->first;
+            capacity += prev->second;
+            eraseFreeBlock(prev);
+        }
+    }
+
+    // A block ending at the top shrinks the used region instead
+    if (offset + capacity == m_top) {
+        m_top = offset;
+        return;
+    }
+    insertFreeBlock(offset, capacity);
+}
+
+void FaceArena::insertFreeBlock(uint32_t offset, uint32_t size) {
+    m_freeByOffset.emplace(offset, size);
+    m_freeBySize.emplace(size, offset);
+}
+
+void FaceArena::eraseFreeBlock(std::map<uint32_t, uint32_t>::iterator it) {
+    auto [first, last] = m_freeBySize.equal_range(it->second);
+    for (auto sizeIt = first; sizeIt != last; ++sizeIt) {
+        if (sizeIt->second == it->first) {
+            m_freeBySize.erase(sizeIt);
+            break;
+        }
+    }
+    m_freeByOffset.erase(it);
+}
+
+} // namespace Zerith
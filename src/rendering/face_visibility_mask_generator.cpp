@@ -1,9 +1,67 @@
 #include "face_visibility_mask_generator.h"
 #include "logger.h"
+#include <bit>
 
 namespace Zerith {
 
 FaceVisibilityMask FaceVisibilityMaskGenerator::generateMask(const ExtendedChunkData& extendedData) {
+    return generateMask(extendedData, OccupancyMasks(extendedData));
+}
+
+FaceVisibilityMask FaceVisibilityMaskGenerator::generateMask(const ExtendedChunkData& extendedData,
+                                                             const OccupancyMasks& occupancy) {
+    // Padded rows keep block x at bit x + 1; bits 1..16 are the chunk itself
+    constexpr uint32_t CENTER_BITS = 0xFFFFu << 1;
+    
+    FaceVisibilityMask mask;
+    
+    for (int faceDir = 0; faceDir < 6; ++faceDir) {
+        auto direction = static_cast<FaceVisibilityMask::FaceDirection>(faceDir);
+        const glm::ivec3 offset = getDirectionOffset(direction);
+        const auto neighborFullFace = OccupancyMasks::fullFace(getOppositeFaceIndex(direction));
+        
+        // Shift a neighbor row so its bits line up with the blocks they touch
+        auto neighborRow = [&](OccupancyMasks::Category category, int y, int z) {
+            uint32_t row = occupancy.getRow(category, y + offset.y, z + offset.z);
+            return offset.x > 0 ? row >> 1 : offset.x < 0 ? row << 1 : row;
+        };
+        
+        for (int z = 0; z < FaceVisibilityMask::CHUNK_SIZE; ++z) {
+            for (int y = 0; y < FaceVisibilityMask::CHUNK_SIZE; ++y) {
+                const uint32_t opaque = occupancy.getRow(OccupancyMasks::OPAQUE, y, z);
+                const uint32_t cullable = occupancy.getRow(OccupancyMasks::CULLABLE, y, z);
+                const uint32_t transparent = occupancy.getRow(OccupancyMasks::TRANSPARENT, y, z);
+                const uint32_t fluid = occupancy.getRow(OccupancyMasks::FLUID, y, z);
+                const uint32_t coveredByNeighbor = neighborRow(neighborFullFace, y, z);
+                
+                // Opaque faces hide behind full neighbor faces, water behind full opaque faces
+                uint32_t visible = (opaque & ~(cullable & coveredByNeighbor))
+                                 | (transparent & ~(fluid & coveredByNeighbor));
+                
+                // Transparent blocks only cull against the same block type (glass to glass)
+                uint32_t sameTypeCandidates = transparent & neighborRow(OccupancyMasks::TRANSPARENT, y, z) & CENTER_BITS;
+                while (sameTypeCandidates != 0) {
+                    const int bit = std::countr_zero(sameTypeCandidates);
+                    sameTypeCandidates &= sameTypeCandidates - 1;
+                    
+                    const int x = bit - 1;
+                    BlockType current = extendedData.getBlock(x, y, z);
+                    BlockType adjacent = extendedData.getBlock(x + offset.x, y + offset.y, z + offset.z);
+                    if (current == adjacent && adjacent != Blocks::OAK_STAIRS) {
+                        visible &= ~(1u << bit);
+                    }
+                }
+                
+                mask.setRowVisible(y, z, direction, static_cast<uint16_t>(visible >> 1));
+            }
+        }
+    }
+    
+    LOG_TRACE("Generated face visibility mask with %zu visible faces", mask.getTotalVisibleFaces());
+    return mask;
+}
+
+FaceVisibilityMask FaceVisibilityMaskGenerator::generateMaskPerVoxel(const ExtendedChunkData& extendedData) {
     FaceVisibilityMask mask;
     
     // Generate mask for each face direction
@@ -25,16 +83,15 @@ FaceVisibilityMask FaceVisibilityMaskGenerator::generateMask(const ExtendedChunk
     return mask;
 }
 
+FaceVisibilityMask FaceVisibilityMaskGenerator::generateMask(const ChunkNeighborhood& neighborhood) {
+    return generateMask(ExtendedChunkData(neighborhood));
+}
+
 bool FaceVisibilityMaskGenerator::isFaceVisibleInternal(const ExtendedChunkData& extendedData,
                                                        int x, int y, int z,
                                                        FaceVisibilityMask::FaceDirection direction) {
-    // Convert local chunk coordinates to extended data coordinates (add 1 for border)
-    int extX = x + 1;
-    int extY = y + 1;
-    int extZ = z + 1;
-    
-    // Get current block
-    BlockType currentBlock = extendedData.getBlock(extX, extY, extZ);
+    // ExtendedChunkData takes chunk-local coordinates directly (-1 to 16)
+    BlockType currentBlock = extendedData.getBlock(x, y, z);
     
     // If current block is air, face is never visible
     if (currentBlock == Blocks::AIR) {
@@ -43,9 +100,9 @@ bool FaceVisibilityMaskGenerator::isFaceVisibleInternal(const ExtendedChunkData&
     
     // Get neighbor block using direction offset
     glm::ivec3 offset = getDirectionOffset(direction);
-    int neighborX = extX + offset.x;
-    int neighborY = extY + offset.y;
-    int neighborZ = extZ + offset.z;
+    int neighborX = x + offset.x;
+    int neighborY = y + offset.y;
+    int neighborZ = z + offset.z;
     
     BlockType adjacentBlock = extendedData.getBlock(neighborX, neighborY, neighborZ);
     
@@ -3,7 +3,9 @@
 
 namespace Zerith {
 
-void IndirectDrawManager::addChunkData(uint32_t faceCount, const float* minBounds, const float* maxBounds, uint32_t firstFaceIndex) {
+void IndirectDrawManager::addChunkData(const uint32_t* layerFaceCounts, const float* minBounds, const float* maxBounds,
+                                       uint32_t firstFaceIndex, const int32_t* origin) {
+    uint32_t faceCount = layerFaceCounts[0] + layerFaceCounts[1] + layerFaceCounts[2];
     if (faceCount == 0) return;
     
     // Add chunk data for GPU processing
@@ -11,11 +13,11 @@ void IndirectDrawManager::addChunkData(uint32_t faceCount, const float* minBound
     std::memcpy(chunkData.minBounds, minBounds, sizeof(float) * 3);
     std::memcpy(chunkData.maxBounds, maxBounds, sizeof(float) * 3);
     chunkData.firstFaceIndex = firstFaceIndex;
-    chunkData.faceCount = faceCount;
+    std::memcpy(chunkData.layerFaceCounts, layerFaceCounts, sizeof(chunkData.layerFaceCounts));
+    std::memcpy(chunkData.origin, origin, sizeof(chunkData.origin));
     chunkData.padding1 = 0.0f;
     chunkData.padding2 = 0.0f;
-    chunkData.padding3[0] = 0;
-    chunkData.padding3[1] = 0;
+    chunkData.padding3 = 0;
     
     m_chunkData.push_back(chunkData);
     m_totalFaceCount += faceCount;
@@ -28,7 +30,10 @@ void IndirectDrawManager::setSingleDrawCommand(uint32_t taskWorkgroups, uint32_t
 
 void IndirectDrawManager::addChunkDrawCommand(uint32_t faceCount, const float* minBounds, const float* maxBounds, uint32_t firstFaceIndex) {
     // Legacy method - adds both chunk data and a draw command
-    addChunkData(faceCount, minBounds, maxBounds, firstFaceIndex);
+    const uint32_t layerFaceCounts[3] = {faceCount, 0, 0};
+    const int32_t origin[3] = {static_cast<int32_t>(minBounds[0]), static_cast<int32_t>(minBounds[1]),
+                               static_cast<int32_t>(minBounds[2])};
+    addChunkData(layerFaceCounts, minBounds, maxBounds, firstFaceIndex, origin);
     m_drawCommands.emplace_back(1, 1, 1);
 }
 
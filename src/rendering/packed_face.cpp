@@ -0,0 +1,85 @@
+#include "packed_face.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Zerith {
+
+namespace {
+
+constexpr uint32_t TEN_BITS = 0x3FFu;
+constexpr uint32_t TWELVE_BITS = 0xFFFu;
+constexpr uint32_t UNKNOWN_DIRECTION = 7;
+constexpr uint32_t PACKED_MISSING_LAYER = 0xFFFFu;
+
+uint32_t quantize(float value, float scale, int bias, uint32_t mask) {
+    long units = std::lround(value * scale) + bias;
+    return static_cast<uint32_t>(std::clamp<long>(units, 0, mask));
+}
+
+} // namespace
+
+PackedFace PackedFace::pack(const FaceInstance& face, const glm::ivec3& chunkOrigin) {
+    const glm::vec3 local = face.position - glm::vec3(chunkOrigin);
+
+    PackedFace packed;
+    packed.position = quantize(local.x, POSITION_SCALE, POSITION_BIAS, TEN_BITS)
+                    | quantize(local.y, POSITION_SCALE, POSITION_BIAS, TEN_BITS) << 10
+                    | quantize(local.z, POSITION_SCALE, POSITION_BIAS, TEN_BITS) << 20;
+
+    const uint32_t direction = face.faceDirection >= 0 && face.faceDirection < 6
+        ? static_cast<uint32_t>(face.faceDirection) : UNKNOWN_DIRECTION;
+    const uint32_t ao = aoLevel(face.ao.x) | aoLevel(face.ao.y) << 2
+                      | aoLevel(face.ao.z) << 4 | aoLevel(face.ao.w) << 6;
+    packed.shape = quantize(face.scale.x, POSITION_SCALE, 0, TEN_BITS)
+                 | quantize(face.scale.y, POSITION_SCALE, 0, TEN_BITS) << 10
+                 | direction << 20
+                 | ao << 23;
+
+    const uint32_t layer = face.textureLayer == MISSING_TEXTURE_LAYER
+        ? PACKED_MISSING_LAYER : std::min(face.textureLayer, PACKED_MISSING_LAYER - 1);
+    packed.uvMin = quantize(face.uv.x, UV_SCALE, 0, TWELVE_BITS)
+                 | quantize(face.uv.y, UV_SCALE, 0, TWELVE_BITS) << 12
+                 | (layer & 0xFFu) << 24;
+    packed.uvMax = quantize(face.uv.z, UV_SCALE, 0, TWELVE_BITS)
+                 | quantize(face.uv.w, UV_SCALE, 0, TWELVE_BITS) << 12
+                 | (layer >> 8) << 24;
+    return packed;
+}
+
+uint32_t PackedFace::aoLevel(float ao) {
+    return static_cast<uint32_t>(std::clamp<long>(std::lround(ao * 3.0f), 0, 3));
+}
+
+uint32_t PackedFace::getTextureLayer() const {
+    uint32_t layer = (uvMin >> 24) | (uvMax >> 24) << 8;
+    return layer == PACKED_MISSING_LAYER ? MISSING_TEXTURE_LAYER : layer;
+}
+
+PackedFace::FaceInstance PackedFace::unpack(const glm::ivec3& chunkOrigin, RenderLayer renderLayer) const {
+    auto positionAxis = [this](int shift) {
+        return static_cast<float>(static_cast<int>((position >> shift) & TEN_BITS) - POSITION_BIAS) / POSITION_SCALE;
+    };
+    auto uvAxis = [](uint32_t word, int shift) {
+        return static_cast<float>((word >> shift) & TWELVE_BITS) / UV_SCALE;
+    };
+    auto aoCorner = [this](int corner) {
+        return static_cast<float>((shape >> (23 + corner * 2)) & 0x3u) / 3.0f;
+    };
+
+    const uint32_t direction = getFaceDirection();
+    const int faceDirection = direction < 6 ? static_cast<int>(direction) : -1;
+    const glm::quat rotation = BlockbenchInstanceGenerator::Generator::createFaceRotation(faceDirection);
+
+    return FaceInstance(
+        glm::vec3(chunkOrigin) + glm::vec3(positionAxis(0), positionAxis(10), positionAxis(20)),
+        glm::vec4(rotation.x, rotation.y, rotation.z, rotation.w),
+        glm::vec3(static_cast<float>(shape & TEN_BITS) / POSITION_SCALE,
+                  static_cast<float>((shape >> 10) & TEN_BITS) / POSITION_SCALE, 1.0f),
+        faceDirection,
+        glm::vec4(uvAxis(uvMin, 0), uvAxis(uvMin, 12), uvAxis(uvMax, 0), uvAxis(uvMax, 12)),
+        getTextureLayer(),
+        renderLayer,
+        glm::vec4(aoCorner(0), aoCorner(1), aoCorner(2), aoCorner(3)));
+}
+
+} // namespace Zerith
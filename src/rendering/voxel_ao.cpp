@@ -1,6 +1,8 @@
 #include "voxel_ao.h"
 #include "block_properties.h"
 #include "chunk_manager.h"
+#include "content_hash.h"
+#include <bit>
 
 namespace Zerith
 {
@@ -34,6 +36,34 @@ namespace Zerith
         return (3.0f - occluders) / 3.0f;
     }
 
+    namespace
+    {
+        // Offset from a face's block to the plane its vertices sample, per face direction
+        constexpr int FACE_NORMALS[6][3] = {
+            {0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1}, {-1, 0, 0}, {1, 0, 0}
+        };
+
+        // The two edge neighbors each vertex (x, y, z, w of the AO vector) samples in
+        // that plane, following the shader's corner order; the corner neighbor is
+        // their sum
+        constexpr int VERTEX_SIDES[6][4][2][3] = {
+            // Down: +X+Z, -X-Z, -X+Z, +X-Z
+            {{{1, 0, 0}, {0, 0, 1}}, {{-1, 0, 0}, {0, 0, -1}}, {{-1, 0, 0}, {0, 0, 1}}, {{1, 0, 0}, {0, 0, -1}}},
+            // Up: -X+Z, -X-Z, +X+Z, +X-Z
+            {{{-1, 0, 0}, {0, 0, 1}}, {{-1, 0, 0}, {0, 0, -1}}, {{1, 0, 0}, {0, 0, 1}}, {{1, 0, 0}, {0, 0, -1}}},
+            // North: +X+Y, -X-Y, -X+Y, +X-Y
+            {{{1, 0, 0}, {0, 1, 0}}, {{-1, 0, 0}, {0, -1, 0}}, {{-1, 0, 0}, {0, 1, 0}}, {{1, 0, 0}, {0, -1, 0}}},
+            // South: -X+Y, +X-Y, +X+Y, -X-Y
+            {{{-1, 0, 0}, {0, 1, 0}}, {{1, 0, 0}, {0, -1, 0}}, {{1, 0, 0}, {0, 1, 0}}, {{-1, 0, 0}, {0, -1, 0}}},
+            // West: +Z+Y, -Z-Y, -Z+Y, +Z-Y
+            {{{0, 0, 1}, {0, 1, 0}}, {{0, 0, -1}, {0, -1, 0}}, {{0, 0, -1}, {0, 1, 0}}, {{0, 0, 1}, {0, -1, 0}}},
+            // East: -Z+Y, -Z-Y, +Z+Y, +Z-Y
+            {{{0, 0, -1}, {0, 1, 0}}, {{0, 0, -1}, {0, -1, 0}}, {{0, 0, 1}, {0, 1, 0}}, {{0, 0, 1}, {0, -1, 0}}},
+        };
+
+        constexpr uint32_t ROW_LANES = 0xFFFFu;
+    }
+
     glm::vec4 VoxelAO::calculateFaceAO(const ChunkManager* chunkManager, const glm::ivec3& chunkWorldPos, int x, int y, int z, int faceDirection)
     {
         // Debug mode override
@@ -44,67 +74,83 @@ namespace Zerith
 
         glm::vec4 ao(1.0f); // Default to no occlusion
 
-        // 0fps.net algorithm: proper vertex neighbor sampling for each face
-        // Each vertex samples 3 neighbors: 2 edge-adjacent + 1 corner
-        switch (faceDirection)
+        // 0fps.net algorithm: each vertex samples 2 edge-adjacent neighbors + 1 corner
+        if (faceDirection >= 0 && faceDirection < 6)
         {
-        case 0: // Down face (Y-)
-            // Looking at bottom face, vertices are at Y-1
-            ao.x = calculateVertexAO(chunkManager, chunkWorldPos, x, y - 1, z, 1, 0, 0, 0, 0, 1, 1, 0, 1); // +X, +Z vertex
-            ao.y = calculateVertexAO(chunkManager, chunkWorldPos, x, y - 1, z, -1, 0, 0, 0, 0, -1, -1, 0, -1); // -X, -Z vertex
-            ao.z = calculateVertexAO(chunkManager, chunkWorldPos, x, y - 1, z, -1, 0, 0, 0, 0, 1, -1, 0, 1); // -X, +Z vertex
-            ao.w = calculateVertexAO(chunkManager, chunkWorldPos, x, y - 1, z, 1, 0, 0, 0, 0, -1, 1, 0, -1); // +X, -Z vertex
-            break;
-
-        case 1: // Up face (Y+)
-            // Looking at top face, vertices are at Y+1 - fixed left-to-right order
-            ao.x = calculateVertexAO(chunkManager, chunkWorldPos, x, y + 1, z, -1, 0, 0, 0, 0, 1, -1, 0, 1); // -X, +Z vertex (top-left)
-            ao.y = calculateVertexAO(chunkManager, chunkWorldPos, x, y + 1, z, -1, 0, 0, 0, 0, -1, -1, 0, -1); // -X, -Z vertex (bottom-left)
-            ao.z = calculateVertexAO(chunkManager, chunkWorldPos, x, y + 1, z, 1, 0, 0, 0, 0, 1, 1, 0, 1); // +X, +Z vertex (top-right)
-            ao.w = calculateVertexAO(chunkManager, chunkWorldPos, x, y + 1, z, 1, 0, 0, 0, 0, -1, 1, 0, -1); // +X, -Z vertex (bottom-right)
-            break;
-
-        case 2: // North face (Z-)
-            // Looking at front face, vertices are at Z-1
-            ao.x = calculateVertexAO(chunkManager, chunkWorldPos, x, y, z - 1, 1, 0, 0, 0, 1, 0, 1, 1, 0); // +X, +Y vertex
-            ao.y = calculateVertexAO(chunkManager, chunkWorldPos, x, y, z - 1, -1, 0, 0, 0, -1, 0, -1, -1, 0); // -X, -Y vertex
-            ao.z = calculateVertexAO(chunkManager, chunkWorldPos, x, y, z - 1, -1, 0, 0, 0, 1, 0, -1, 1, 0); // -X, +Y vertex
-            ao.w = calculateVertexAO(chunkManager, chunkWorldPos, x, y, z - 1, 1, 0, 0, 0, -1, 0, 1, -1, 0); // +X, -Y vertex
-            break;
-
-        case 3: // South face (Z+)
-            // Looking at back face, vertices are at Z+1
-            ao.x = calculateVertexAO(chunkManager, chunkWorldPos, x, y, z + 1, -1, 0, 0, 0, 1, 0, -1, 1, 0); // -X, +Y vertex (flipped)
-            ao.y = calculateVertexAO(chunkManager, chunkWorldPos, x, y, z + 1, 1, 0, 0, 0, -1, 0, 1, -1, 0); // +X, -Y vertex (flipped)
-            ao.z = calculateVertexAO(chunkManager, chunkWorldPos, x, y, z + 1, 1, 0, 0, 0, 1, 0, 1, 1, 0); // +X, +Y vertex (flipped)
-            ao.w = calculateVertexAO(chunkManager, chunkWorldPos, x, y, z + 1, -1, 0, 0, 0, -1, 0, -1, -1, 0); // -X, -Y vertex (flipped)
-            break;
-
-        case 4: // West face (X-)
-            // Looking at left face, vertices are at X-1
-            ao.x = calculateVertexAO(chunkManager, chunkWorldPos, x - 1, y, z, 0, 0, -1, 0, 1, 0, 0, 1, 1); // +Z, +Y vertex
-            ao.y = calculateVertexAO(chunkManager, chunkWorldPos, x - 1, y, z, 0, 0, 1, 0, -1, 0, 0, -1, -1); // -Z, -Y vertex
-            ao.z = calculateVertexAO(chunkManager, chunkWorldPos, x - 1, y, z, 0, 0, 1, 0, 1, 0, 0, 1, -1); // -Z, +Y vertex
-            ao.w = calculateVertexAO(chunkManager, chunkWorldPos, x - 1, y, z, 0, 0, -1, 0, -1, 0, 0, -1, 1); // +Z, -Y vertex
-            break;
-
-        case 5: // East face (X+)
-            // Looking at right face, vertices are at X+1 - corrected left-right mapping
-            ao.x = calculateVertexAO(chunkManager, chunkWorldPos, x + 1, y, z, 0, 0, -1, 0, 1, 0, 0, 1, -1); // -Z, +Y vertex (top-left)
-            ao.y = calculateVertexAO(chunkManager, chunkWorldPos, x + 1, y, z, 0, 0, -1, 0, -1, 0, 0, -1, -1); // -Z, -Y vertex (bottom-left)
-            ao.z = calculateVertexAO(chunkManager, chunkWorldPos, x + 1, y, z, 0, 0, 1, 0, 1, 0, 0, 1, 1); // +Z, +Y vertex (top-right)
-            ao.w = calculateVertexAO(chunkManager, chunkWorldPos, x + 1, y, z, 0, 0, 1, 0, -1, 0, 0, -1, 1); // +Z, -Y vertex (bottom-right)
-            break;
+            const int* normal = FACE_NORMALS[faceDirection];
+            for (int vertex = 0; vertex < 4; ++vertex)
+            {
+                const int* side1 = VERTEX_SIDES[faceDirection][vertex][0];
+                const int* side2 = VERTEX_SIDES[faceDirection][vertex][1];
+                ao[vertex] = calculateVertexAO(chunkManager, chunkWorldPos,
+                                               x + normal[0], y + normal[1], z + normal[2],
+                                               side1[0], side1[1], side1[2],
+                                               side2[0], side2[1], side2[2],
+                                               side1[0] + side2[0], side1[1] + side2[1], side1[2] + side2[2]);
+            }
         }
 
-        // Apply multiplier to final AO values
-        ao *= s_aoMultiplier;
-        ao = glm::clamp(ao, 0.0f, 1.0f);
-
+        // The strength multiplier is applied by the shader; faces store the 2-bit level
         return ao;
     }
 
+    VoxelAO::RowAO VoxelAO::calculateRowAO(const OccupancyMasks& masks, int y, int z, int faceDirection)
+    {
+        RowAO rowAO; // Default to no occlusion
+        if (faceDirection < 0 || faceDirection >= 6)
+        {
+            return rowAO;
+        }
 
+        const int* normal = FACE_NORMALS[faceDirection];
+
+        // Occluders at offset (dx, dy, dz) from each face of the row, bit x per face
+        auto occluders = [&](int dx, int dy, int dz) -> uint32_t
+        {
+            uint32_t row = masks.getRow(OccupancyMasks::AO_OCCLUDER, y + normal[1] + dy, z + normal[2] + dz);
+            return (row >> (ExtendedChunkData::BORDER_SIZE + normal[0] + dx)) & ROW_LANES;
+        };
+
+        for (int vertex = 0; vertex < 4; ++vertex)
+        {
+            const int* side1 = VERTEX_SIDES[faceDirection][vertex][0];
+            const int* side2 = VERTEX_SIDES[faceDirection][vertex][1];
+            const uint32_t s1 = occluders(side1[0], side1[1], side1[2]);
+            const uint32_t s2 = occluders(side2[0], side2[1], side2[2]);
+            const uint32_t corner = occluders(side1[0] + side2[0], side1[1] + side2[1], side1[2] + side2[2]);
+
+            // Level = 3 - occluders, or 0 when both sides are blocked. Count the
+            // occluders per lane with a bitwise full adder; 3 - count is its complement
+            const uint32_t ones = s1 ^ s2 ^ corner;
+            const uint32_t twos = (s1 & s2) | (corner & (s1 ^ s2));
+            rowAO.low[vertex] = static_cast<uint16_t>(~(ones | (s1 & s2)) & ROW_LANES);
+            rowAO.high[vertex] = static_cast<uint16_t>(~twos & ROW_LANES);
+        }
+
+        return rowAO;
+    }
+
+    glm::vec4 VoxelAO::getFaceAO(const RowAO& rowAO, int x)
+    {
+        // Debug mode override
+        if (s_debugMode)
+        {
+            return s_debugAO;
+        }
+
+        glm::vec4 ao;
+        for (int vertex = 0; vertex < 4; ++vertex)
+        {
+            ao[vertex] = static_cast<float>(rowAO.getLevel(x, vertex)) / 3.0f;
+        }
+
+        return ao;
+    }
+
+    glm::vec4 VoxelAO::calculateFaceAO(const OccupancyMasks& masks, int x, int y, int z, int faceDirection)
+    {
+        return getFaceAO(calculateRowAO(masks, y, z, faceDirection), x);
+    }
 
     glm::vec4 VoxelAO::calculateFaceAODebug(const Chunk& chunk, int x, int y, int z, int faceDirection)
     {
@@ -113,6 +159,15 @@ namespace Zerith
         return glm::vec4(1.0f, 0.8f, 0.6f, 0.4f);
     }
 
+    uint64_t VoxelAO::getSettingsHash()
+    {
+        ContentHash hash;
+        hash.add(s_debugMode ? 1 : 0);
+        hash.add(uint64_t{std::bit_cast<uint32_t>(s_debugAO.x)} << 32 | std::bit_cast<uint32_t>(s_debugAO.y));
+        hash.add(uint64_t{std::bit_cast<uint32_t>(s_debugAO.z)} << 32 | std::bit_cast<uint32_t>(s_debugAO.w));
+        return hash.finish();
+    }
+
     bool VoxelAO::isBlockOccluding(BlockType blockType)
     {
         if (blockType == Blocks::AIR)
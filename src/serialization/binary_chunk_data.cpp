@@ -7,6 +7,16 @@ namespace Zerith {
 const BinaryChunkData::BlockMask BinaryChunkData::s_emptyMask;
 
 BinaryChunkData::BinaryChunkData(const Chunk& chunk) {
+    // The chunk's block counts answer the common all-air and single-type cases without a scan
+    if (chunk.isEmpty()) {
+        return;
+    }
+    if (chunk.isUniform()) {
+        m_blockMasks[chunk.getUniformBlock()].set();
+        m_activeBlockTypes.push_back(chunk.getUniformBlock());
+        return;
+    }
+    
     // Scan through all blocks in the chunk and build bit masks
     for (int x = 0; x < CHUNK_SIZE; ++x) {
         for (int y = 0; y < CHUNK_SIZE; ++y) {
@@ -409,17 +409,15 @@ bool HybridChunkMeshGenerator::canUseBinaryMeshing(
 bool HybridChunkMeshGenerator::canNeighborUseBinaryMeshing(
     const Chunk& chunk
 ) {
-    // Create temporary binary chunk data to get active block types
-    BinaryChunkData binaryData(chunk);
-    
-    // Check if all blocks can use binary meshing
-    for (BlockType blockType : binaryData.getActiveBlockTypes()) {
-        if (!canUseBinaryMeshing(blockType)) {
-            return false;
+    // The chunk tracks which block types it contains, so no need to scan its blocks
+    bool allBinary = true;
+    chunk.forEachBlockType([&allBinary](BlockType blockType, int) {
+        if (blockType != Blocks::AIR && !canUseBinaryMeshing(blockType)) {
+            allBinary = false;
         }
-    }
+    });
     
-    return true;
+    return allBinary;
 }
 
 std::vector<HybridChunkMeshGenerator::FaceInstance> HybridChunkMeshGenerator::generateComplexBlockMesh(
@@ -3,6 +3,8 @@
 #include "player.h"
 #include "chunk_manager.h"
 #include "voxel_ao.h"
+#include "benchmarks.h"
+#include "memory_stats.h"
 
 #include <imgui.h>
 #include <imgui_impl_glfw.h>
@@ -10,6 +12,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <vector>
 
 bool ImGuiIntegration::initialize(GLFWwindow* window, VkInstance instance, VkPhysicalDevice physicalDevice,
                                 VkDevice device, uint32_t queueFamily, VkQueue queue, VkRenderPass renderPass,
@@ -190,7 +193,7 @@ void ImGuiIntegration::renderChunkWindow(const Zerith::ChunkManager& chunkManage
     ImGui::End();
 }
 
-void ImGuiIntegration::renderDebugWindow(const Zerith::Player* player, const Zerith::ChunkManager* chunkManager) {
+void ImGuiIntegration::renderDebugWindow(const Zerith::Player* player, Zerith::ChunkManager* chunkManager) {
     if (!m_initialized) return;
     
     ImGui::Begin("Debug Info");
@@ -199,6 +202,9 @@ void ImGuiIntegration::renderDebugWindow(const Zerith::Player* player, const Zer
     if (ImGui::CollapsingHeader("Performance", ImGuiTreeNodeFlags_DefaultOpen)) {
         ImGui::Text("FPS: %.1f", ImGui::GetIO().Framerate);
         ImGui::Text("Frame Time: %.3f ms", 1000.0f / ImGui::GetIO().Framerate);
+        ImGui::Text("Memory: %.1f MB resident, %.1f MB peak",
+                    Zerith::MemoryStats::getCurrentResidentBytes() / (1024.0 * 1024.0),
+                    Zerith::MemoryStats::getPeakResidentBytes() / (1024.0 * 1024.0));
         
         // Add frame time to history for graph
         static int frame_count = 0;
@@ -290,14 +296,245 @@ void ImGuiIntegration::renderDebugWindow(const Zerith::Player* player, const Zer
     // Chunk section
     if (ImGui::CollapsingHeader("Chunks", ImGuiTreeNodeFlags_DefaultOpen)) {
         if (chunkManager) {
-            ImGui::Text("Render Distance: %d", chunkManager->getRenderDistance());
-            ImGui::Text("Loaded Chunks: %zu", chunkManager->getLoadedChunkCount());
-            ImGui::Text("Face Instances: %zu", chunkManager->getAllFaceInstances().size());
+            ImGui::Text("Render Distance: %d (vertical %d)", chunkManager->getRenderDistance(),
+                        chunkManager->getVerticalRenderDistance());
+            ImGui::Text("Loaded Chunks: %zu in %zu columns", chunkManager->getLoadedChunkCount(),
+                        chunkManager->getLoadedColumnCount());
+            ImGui::Text("Pending: %zu loads, %zu unloads", chunkManager->getPendingLoadCount(),
+                        chunkManager->getPendingUnloadCount());
+            const auto& faceArena = chunkManager->getFaceArena();
+            ImGui::Text("Face Instances: %zu", faceArena.getFaceCount());
+            ImGui::Text("Face Arena: %u slots, %zu free", faceArena.getCapacity(), faceArena.getFreeSlotCount());
+            ImGui::Text("Face Data: %.2f MB", faceArena.getFaceMemoryUsage() / (1024.0 * 1024.0));
+            auto storageStats = chunkManager->getChunkStorageStats();
+            ImGui::Text("Block Storage: %.2f MB", storageStats.memoryBytes / (1024.0 * 1024.0));
+            ImGui::Text("Uniform Chunks: %zu / %zu", storageStats.uniformChunks, chunkManager->getLoadedChunkCount());
+            ImGui::Text("Skipped Uniform Meshes: %zu", storageStats.skippedMeshes);
+            const auto& latency = chunkManager->getChunkLatencyStats();
+            ImGui::Text("Time to Visible: %.0f ms in view (%zu), %.0f ms out of view (%zu)",
+                        latency.avgInViewMs, latency.inViewSamples,
+                        latency.avgOutOfViewMs, latency.outOfViewSamples);
+            ImGui::Text("Re-prioritisations: %zu", chunkManager->getReprioritizationCount());
+            const auto& taskStats = chunkManager->getChunkTaskStats();
+            ImGui::Text("Cancelled Out of Range: %zu loads, %zu meshes", taskStats.cancelledLoads,
+                        taskStats.cancelledMeshes);
+            ImGui::Text("Wasted Work: %zu generations, %zu meshes", taskStats.wastedGenerations,
+                        taskStats.wastedMeshes);
+            ImGui::Text("Meshes per Chunk: %.2f (%zu meshes, %zu chunks)",
+                        taskStats.chunksMeshed > 0
+                            ? static_cast<double>(taskStats.meshesBuilt) / taskStats.chunksMeshed : 0.0,
+                        taskStats.meshesBuilt, taskStats.chunksMeshed);
+            ImGui::Text("Edit Remeshes: %zu requested, %zu queued, %zu incremental", taskStats.remeshRequests,
+                        taskStats.remeshesFlushed, taskStats.incrementalRemeshes);
+
+            // Edit-to-visible histograms, buckets labelled by their upper bound in ms
+            const auto& editLatency = chunkManager->getEditLatencyStats();
+            auto showEditLatency = [](const char* label, const EditLatencyHistogram& histogram) {
+                ImGui::Text("Edit to Visible, %s: avg %.1f ms, max %.1f ms (%zu edits)", label,
+                            histogram.avgMs, histogram.maxMs, histogram.samples);
+                if (histogram.samples == 0) {
+                    return;
+                }
+                float values[EditLatencyHistogram::BUCKET_COUNT];
+                for (size_t i = 0; i < EditLatencyHistogram::BUCKET_COUNT; ++i) {
+                    values[i] = static_cast<float>(histogram.buckets[i]);
+                }
+                ImGui::PushID(label);
+                ImGui::PlotHistogram("", values, EditLatencyHistogram::BUCKET_COUNT, 0,
+                                     "1 2 4 8 16 32 64 128 256 ms+", 0.0f, FLT_MAX, ImVec2(0, 50));
+                ImGui::PopID();
+            };
+            showEditLatency("streaming", editLatency.streaming);
+            showEditLatency("idle", editLatency.idle);
+            ImGui::Text("Remesh Hash Hits: %zu / %zu (%.1f%%)", taskStats.meshHashHits, taskStats.meshHashChecks,
+                        taskStats.meshHashChecks > 0
+                            ? 100.0 * static_cast<double>(taskStats.meshHashHits) / taskStats.meshHashChecks : 0.0);
+            
+            const auto& chunkCache = chunkManager->getChunkCache();
+            static int cacheCapacity = static_cast<int>(chunkCache.getCapacity());
+            if (ImGui::SliderInt("Unload Cache Size", &cacheCapacity, 0, 8192)) {
+                chunkManager->setChunkCacheCapacity(static_cast<size_t>(cacheCapacity));
+            }
+            ImGui::Text("Unload Cache: %zu sections, %.2f MB", chunkCache.size(),
+                        chunkCache.getMemoryUsage() / (1024.0 * 1024.0));
+            ImGui::Text("Cache Hits: %zu, misses %zu, evictions %zu", chunkCache.getHits(),
+                        chunkCache.getMisses(), chunkCache.getEvictions());
         } else {
             ImGui::Text("ChunkManager data not available");
         }
     }
     
+    // Benchmarks section
+    if (ImGui::CollapsingHeader("Benchmarks")) {
+        static Zerith::Benchmarks::ChunkStorageResult storageResult;
+        static bool hasStorageResult = false;
+        
+        if (ImGui::Button("Run Chunk Storage Benchmark")) {
+            storageResult = Zerith::Benchmarks::runChunkStorageBenchmark();
+            hasStorageResult = true;
+        }
+        
+        if (hasStorageResult) {
+            ImGui::Text("getBlock: flat %.2f ns, palette %.2f ns", storageResult.flatGetNs, storageResult.paletteGetNs);
+            ImGui::Text("setBlock: flat %.2f ns, palette %.2f ns", storageResult.flatSetNs, storageResult.paletteSetNs);
+            ImGui::Text("Storage: %zu B flat, %zu B palette (%zu entries, %d bits)",
+                        storageResult.flatBytes, storageResult.paletteBytes,
+                        storageResult.paletteEntries, storageResult.bitsPerBlock);
+        }
+        
+        ImGui::Separator();
+        static std::vector<Zerith::Benchmarks::ChunkCrossingResult> crossingResults;
+        
+        if (ImGui::Button("Run Chunk Crossing Benchmark (R = 8/16/32)")) {
+            crossingResults.clear();
+            for (int radius : {8, 16, 32}) {
+                crossingResults.push_back(Zerith::Benchmarks::runChunkCrossingBenchmark(radius));
+            }
+        }
+        
+        for (const auto& crossing : crossingResults) {
+            ImGui::Text("R=%d: cube %.3f ms (%zu candidates), columns %.3f ms (%zu columns), ring delta %.3f ms",
+                        crossing.radius, crossing.cubeScanMs, crossing.cubeCandidates,
+                        crossing.columnScanMs, crossing.columnsVisited, crossing.deltaScanMs);
+        }
+        
+        ImGui::Separator();
+        static std::vector<Zerith::Benchmarks::ChunkLookupContentionResult> contentionResults;
+        
+        if (ImGui::Button("Run Chunk Lookup Contention Benchmark (1/2/4/8 readers)")) {
+            contentionResults.clear();
+            for (int readers : {1, 2, 4, 8}) {
+                contentionResults.push_back(Zerith::Benchmarks::runChunkLookupContentionBenchmark(readers));
+            }
+        }
+        
+        for (const auto& contention : contentionResults) {
+            ImGui::Text("%d readers: map %.1f ns (%zu swaps), directory %.1f ns (%zu swaps)",
+                        contention.readerThreads, contention.mapLookupNs, contention.mapSwaps,
+                        contention.directoryLookupNs, contention.directorySwaps);
+        }
+        
+        ImGui::Separator();
+        static std::vector<Zerith::Benchmarks::CollisionQueryResult> collisionResults;
+        
+        if (ImGui::Button("Run Collision Query Benchmark") && chunkManager && player) {
+            // Player collision box (+0.1 margin) and an 8^3 neighborhood around it
+            const glm::vec3 center = player->getPosition() + glm::vec3(0.0f, 0.9f, 0.0f);
+            collisionResults.clear();
+            collisionResults.push_back(Zerith::Benchmarks::runCollisionQueryBenchmark(
+                *chunkManager, center, glm::vec3(0.4f, 1.0f, 0.4f)));
+            collisionResults.push_back(Zerith::Benchmarks::runCollisionQueryBenchmark(
+                *chunkManager, center, glm::vec3(4.0f), 2000));
+        }
+        
+        for (const auto& collision : collisionResults) {
+            ImGui::Text("%zu blocks: getBlock %.1f ns, copyRegion %.1f ns%s",
+                        collision.blocksPerQuery, collision.perBlockNs, collision.regionNs,
+                        collision.resultsMatch ? "" : " (mismatch!)");
+        }
+        
+        ImGui::Separator();
+        static Zerith::Benchmarks::FacePackingResult packingResult;
+        static bool hasPackingResult = false;
+        
+        if (ImGui::Button("Run Face Packing Benchmark")) {
+            packingResult = Zerith::Benchmarks::runFacePackingBenchmark();
+            hasPackingResult = true;
+        }
+        
+        if (hasPackingResult) {
+            ImGui::Text("%zu faces: %zu B -> %zu B, pack %.1f ns, unpack %.1f ns%s",
+                        packingResult.faces, packingResult.unpackedBytes, packingResult.packedBytes,
+                        packingResult.packNs, packingResult.unpackNs,
+                        packingResult.mismatches == 0 ? "" : " (mismatch!)");
+        }
+        
+        ImGui::Separator();
+        static Zerith::Benchmarks::FaceVisibilityResult visibilityResult;
+        static bool hasVisibilityResult = false;
+        
+        if (ImGui::Button("Run Face Visibility Benchmark")) {
+            visibilityResult = Zerith::Benchmarks::runFaceVisibilityBenchmark();
+            hasVisibilityResult = true;
+        }
+        
+        if (hasVisibilityResult) {
+            ImGui::Text("Per chunk: per-voxel %.1f us, bitwise %.1f us (%zu faces)%s",
+                        visibilityResult.perVoxelUs, visibilityResult.bitwiseUs, visibilityResult.visibleFaces,
+                        visibilityResult.mismatchedRows == 0 ? "" : " (mismatch!)");
+        }
+        
+        ImGui::Separator();
+        static Zerith::Benchmarks::GreedyMeshingResult greedyResult;
+        static bool hasGreedyResult = false;
+        
+        if (ImGui::Button("Run Greedy Meshing Benchmark") && chunkManager && player) {
+            greedyResult = Zerith::Benchmarks::runGreedyMeshingBenchmark(*chunkManager, player->getPosition());
+            hasGreedyResult = true;
+        }
+        
+        if (hasGreedyResult) {
+            ImGui::Text("%zu chunks: per-block %zu faces (%.3f ms), greedy %zu faces (%.3f ms)%s",
+                        greedyResult.chunks, greedyResult.perBlockFaces, greedyResult.perBlockMs,
+                        greedyResult.greedyFaces, greedyResult.greedyMs,
+                        greedyResult.areaMatches ? "" : " (area mismatch!)");
+        }
+        
+        ImGui::Separator();
+        static Zerith::Benchmarks::MeshingAOResult meshingAOResult;
+        static bool hasMeshingAOResult = false;
+        
+        if (ImGui::Button("Run Meshing AO Benchmark") && chunkManager && player) {
+            meshingAOResult = Zerith::Benchmarks::runMeshingAOBenchmark(*chunkManager, player->getPosition());
+            hasMeshingAOResult = true;
+        }
+        
+        if (hasMeshingAOResult) {
+            ImGui::Text("%zu chunks, %zu faces, 1 / %d threads:", meshingAOResult.chunks, meshingAOResult.faces,
+                        meshingAOResult.threads);
+            ImGui::Text("World-query AO: %.2f / %.2f ms", meshingAOResult.worldAOMs, meshingAOResult.worldAOThreadedMs);
+            ImGui::Text("Snapshot AO: %.2f / %.2f ms", meshingAOResult.snapshotAOMs,
+                        meshingAOResult.snapshotAOThreadedMs);
+            ImGui::Text("Meshing with AO: %.2f / %.2f ms", meshingAOResult.meshMs, meshingAOResult.meshThreadedMs);
+        }
+        
+        ImGui::Separator();
+        static Zerith::Benchmarks::IncrementalRemeshResult incrementalResult;
+        static bool hasIncrementalResult = false;
+        
+        if (ImGui::Button("Run Incremental Remesh Benchmark") && chunkManager && player) {
+            incrementalResult = Zerith::Benchmarks::runIncrementalRemeshBenchmark(*chunkManager, player->getPosition());
+            hasIncrementalResult = true;
+        }
+        
+        if (hasIncrementalResult) {
+            ImGui::Text("%zu edits: full %.3f ms, incremental %.3f ms per edit", incrementalResult.edits,
+                        incrementalResult.fullMs, incrementalResult.incrementalMs);
+            ImGui::Text("Fallbacks: %zu, mismatches: %zu%s", incrementalResult.fallbacks, incrementalResult.mismatches,
+                        incrementalResult.mismatches > 0 ? " (incremental mesh differs!)" : "");
+            ImGui::Text("Interleaved edits: %zu, mismatches: %zu%s", incrementalResult.interleavedEdits,
+                        incrementalResult.interleavedMismatches,
+                        incrementalResult.interleavedMismatches > 0 ? " (follow-up remesh stale!)" : "");
+        }
+
+        ImGui::Separator();
+        static Zerith::Benchmarks::MeshAllocationResult allocationResult;
+        static bool hasAllocationResult = false;
+
+        if (ImGui::Button("Run Mesh Allocation Benchmark") && chunkManager && player) {
+            allocationResult = Zerith::Benchmarks::runMeshAllocationBenchmark(*chunkManager, player->getPosition());
+            hasAllocationResult = true;
+        }
+
+        if (hasAllocationResult) {
+            ImGui::Text("%zu chunks, %d threads", allocationResult.chunks, allocationResult.threads);
+            ImGui::Text("Heap: %.2f ms, %.1f allocations per chunk", allocationResult.heapMs,
+                        allocationResult.heapAllocsPerChunk);
+            ImGui::Text("Scratch arena: %.2f ms, %.2f allocations per chunk", allocationResult.arenaMs,
+                        allocationResult.arenaAllocsPerChunk);
+        }
+    }
+    
     // Ambient Occlusion Debug section
     if (ImGui::CollapsingHeader("Ambient Occlusion Debug")) {
         static bool debugMode = false;
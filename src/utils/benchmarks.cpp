@@ -0,0 +1,1103 @@
+#include "benchmarks.h"
+#include "chunk.h"
+#include "chunk_column.h"
+#include "chunk_directory.h"
+#include "chunk_manager.h"
+#include "chunk_mesh_generator.h"
+#include "epoch_reclaimer.h"
+#include "extended_chunk_data.h"
+#include "face_visibility_mask_generator.h"
+#include "blocks.h"
+#include "logger.h"
+#include "packed_face.h"
+#include "scratch_arena.h"
+#include "voxel_ao.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory_resource>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Zerith {
+namespace Benchmarks {
+
+namespace {
+
+using Clock = std::chrono::high_resolution_clock;
+
+double elapsedNs(Clock::time_point start, Clock::time_point end) {
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+// Deterministic pseudo-random access order so both storages see the same pattern
+std::vector<glm::ivec3> makeAccessPattern(size_t count) {
+    std::vector<glm::ivec3> coords;
+    coords.reserve(count);
+    uint32_t state = 0x9E3779B9u;
+    for (size_t i = 0; i < count; ++i) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        coords.emplace_back(state & 15, (state >> 4) & 15, (state >> 8) & 15);
+    }
+    return coords;
+}
+
+// Terrain-like layering: stone, dirt, grass, air
+BlockType layeredBlock(int y) {
+    if (y < 8) return Blocks::STONE;
+    if (y < 11) return Blocks::DIRT;
+    if (y == 11) return Blocks::GRASS_BLOCK;
+    return Blocks::AIR;
+}
+
+// Chunk with a few layers so lookups touch packed storage rather than a uniform value
+std::unique_ptr<Chunk> makeLayeredChunk(const glm::ivec3& chunkPos) {
+    auto chunk = std::make_unique<Chunk>(chunkPos);
+    for (int y = 0; y < Chunk::CHUNK_SIZE; ++y) {
+        for (int z = 0; z < Chunk::CHUNK_SIZE; ++z) {
+            for (int x = 0; x < Chunk::CHUNK_SIZE; ++x) {
+                chunk->setBlock(x, y, z, layeredBlock(y));
+            }
+        }
+    }
+    return chunk;
+}
+
+// Runs readers for durationMs while the calling thread swaps chunks; returns total lookups
+template<typename ReadFn, typename SwapFn>
+size_t runContention(int readerThreads, int durationMs, ReadFn&& read, SwapFn&& swapBatch) {
+    // Readers stop at the deadline on their own so a writer starved by the
+    // shared_mutex cannot stretch the run
+    const auto end = Clock::now() + std::chrono::milliseconds(durationMs);
+    std::atomic<size_t> totalLookups{0};
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < readerThreads; ++t) {
+        readers.emplace_back([&, t]() {
+            uint32_t state = 0x9E3779B9u + t * 0x85EBCA6Bu;
+            size_t lookups = 0;
+            volatile size_t sink = 0;
+            while (Clock::now() < end) {
+                for (int i = 0; i < 256; ++i) {
+                    state ^= state << 13;
+                    state ^= state >> 17;
+                    state ^= state << 5;
+                    sink = sink + read(state);
+                }
+                lookups += 256;
+            }
+            totalLookups.fetch_add(lookups, std::memory_order_relaxed);
+        });
+    }
+
+    // Writer: a batch of unload/reload pairs per simulated frame
+    while (Clock::now() < end) {
+        swapBatch();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    return totalLookups.load();
+}
+
+
+// Snapshots of the non-empty loaded chunks within radius chunks of a point, so
+// every variant of a meshing benchmark sees identical data
+std::vector<ExtendedChunkData> snapshotChunksAround(const ChunkManager& chunkManager, const glm::vec3& center,
+                                                    int radius) {
+    const glm::ivec3 centerChunk = glm::floor(center / static_cast<float>(Chunk::CHUNK_SIZE));
+    std::vector<ExtendedChunkData> snapshots;
+    for (int dz = -radius; dz <= radius; ++dz) {
+        for (int dy = -radius; dy <= radius; ++dy) {
+            for (int dx = -radius; dx <= radius; ++dx) {
+                auto snapshot = chunkManager.createExtendedChunkData(centerChunk + glm::ivec3(dx, dy, dz));
+                if (snapshot && !snapshot->isCenterEmpty()) {
+                    snapshots.push_back(std::move(*snapshot));
+                }
+            }
+        }
+    }
+    return snapshots;
+}
+
+// Runs work(i) for every i below count on `threads` threads pulling indices from
+// a shared counter; returns the wall-clock time in ms
+template<typename WorkFn>
+double runParallel(size_t count, int threads, WorkFn&& work) {
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+            work(i);
+        }
+    };
+
+    auto start = Clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; ++t) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : workers) {
+        thread.join();
+    }
+    return elapsedNs(start, Clock::now()) / 1e6;
+}
+
+// Heap resource that counts its allocations
+class CountingResource final : public std::pmr::memory_resource {
+public:
+    size_t getAllocations() const { return m_allocations.load(std::memory_order_relaxed); }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        m_allocations.fetch_add(1, std::memory_order_relaxed);
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    std::atomic<size_t> m_allocations{0};
+};
+
+} // namespace
+
+ChunkStorageResult runChunkStorageBenchmark(int iterations) {
+    constexpr int SIZE = Chunk::CHUNK_SIZE;
+    const auto coords = makeAccessPattern(Chunk::CHUNK_VOLUME);
+    const BlockType editTypes[4] = {Blocks::STONE, Blocks::OAK_PLANKS, Blocks::GLASS, Blocks::AIR};
+
+    std::array<BlockType, Chunk::CHUNK_VOLUME> flat{};
+    Chunk chunk(glm::ivec3(0));
+    for (int z = 0; z < SIZE; ++z) {
+        for (int y = 0; y < SIZE; ++y) {
+            for (int x = 0; x < SIZE; ++x) {
+                flat[x + y * SIZE + z * SIZE * SIZE] = layeredBlock(y);
+                chunk.setBlock(x, y, z, layeredBlock(y));
+            }
+        }
+    }
+
+    // Accumulate reads so the loops cannot be optimized away
+    volatile uint64_t sink = 0;
+    const double accesses = static_cast<double>(coords.size()) * iterations;
+    ChunkStorageResult result;
+
+    auto start = Clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        uint64_t sum = 0;
+        for (const auto& c : coords) {
+            sum += flat[c.x + c.y * SIZE + c.z * SIZE * SIZE];
+        }
+        sink = sink + sum;
+    }
+    result.flatGetNs = elapsedNs(start, Clock::now()) / accesses;
+
+    start = Clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        uint64_t sum = 0;
+        for (const auto& c : coords) {
+            sum += chunk.getBlock(c.x, c.y, c.z);
+        }
+        sink = sink + sum;
+    }
+    result.paletteGetNs = elapsedNs(start, Clock::now()) / accesses;
+
+    start = Clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        for (size_t j = 0; j < coords.size(); ++j) {
+            const auto& c = coords[j];
+            flat[c.x + c.y * SIZE + c.z * SIZE * SIZE] = editTypes[(i + j) & 3];
+        }
+    }
+    sink = sink + flat[0];
+    result.flatSetNs = elapsedNs(start, Clock::now()) / accesses;
+
+    start = Clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        for (size_t j = 0; j < coords.size(); ++j) {
+            const auto& c = coords[j];
+            chunk.setBlock(c.x, c.y, c.z, editTypes[(i + j) & 3]);
+        }
+    }
+    sink = sink + chunk.getBlock(0, 0, 0);
+    result.paletteSetNs = elapsedNs(start, Clock::now()) / accesses;
+
+    result.flatBytes = sizeof(flat);
+    result.paletteBytes = chunk.getPaletteSize() * sizeof(BlockType) +
+                          Chunk::CHUNK_VOLUME * static_cast<size_t>(chunk.getBitsPerBlock()) / 8;
+    result.paletteEntries = chunk.getPaletteSize();
+    result.bitsPerBlock = chunk.getBitsPerBlock();
+
+    LOG_INFO("Chunk storage benchmark (%d x %zu accesses): get flat %.2f ns / palette %.2f ns, "
+             "set flat %.2f ns / palette %.2f ns, storage %zu B flat vs %zu B palette (%zu entries, %d bits)",
+             iterations, coords.size(), result.flatGetNs, result.paletteGetNs,
+             result.flatSetNs, result.paletteSetNs, result.flatBytes, result.paletteBytes,
+             result.paletteEntries, result.bitsPerBlock);
+
+    return result;
+}
+
+ChunkCrossingResult runChunkCrossingBenchmark(int radius, int verticalRadius, int crossings) {
+    ChunkCrossingResult result;
+    result.radius = radius;
+
+    const glm::ivec3 start(0, 4, 0); // Roughly surface level
+    const glm::ivec3 step(1, 0, 0);
+    volatile size_t sink = 0;
+
+    // Previous model: spherical range over a (2R+1)^3 cube, taking the chunk map
+    // and loading map locks for every candidate
+    {
+        std::unordered_map<glm::ivec3, int> chunks;
+        std::unordered_map<glm::ivec3, int> loading;
+        std::shared_mutex chunksMutex;
+        std::mutex loadingMutex;
+
+        auto inRange = [radius](const glm::ivec3& pos, const glm::ivec3& center) {
+            glm::ivec3 d = pos - center;
+            return d.x * d.x + d.y * d.y + d.z * d.z <= radius * radius;
+        };
+
+        auto forEachCandidate = [radius](const glm::ivec3& center, auto&& fn) {
+            for (int dx = -radius; dx <= radius; ++dx) {
+                for (int dy = -radius; dy <= radius; ++dy) {
+                    for (int dz = -radius; dz <= radius; ++dz) {
+                        fn(center + glm::ivec3(dx, dy, dz));
+                    }
+                }
+            }
+        };
+
+        forEachCandidate(start, [&](const glm::ivec3& pos) {
+            if (ChunkColumn::isValidSection(pos.y) && inRange(pos, start)) chunks[pos] = 0;
+        });
+
+        glm::ivec3 center = start;
+        double totalNs = 0.0;
+        for (int i = 0; i < crossings; ++i) {
+            center += step;
+            std::vector<glm::ivec3> leaving;
+            std::vector<glm::ivec3> entering;
+            size_t candidates = 0;
+
+            auto begin = Clock::now();
+            {
+                std::shared_lock<std::shared_mutex> lock(chunksMutex);
+                for (const auto& [pos, value] : chunks) {
+                    if (!inRange(pos, center)) leaving.push_back(pos);
+                }
+            }
+            forEachCandidate(center, [&](const glm::ivec3& pos) {
+                candidates++;
+                if (!ChunkColumn::isValidSection(pos.y) || !inRange(pos, center)) return;
+                {
+                    std::shared_lock<std::shared_mutex> lock(chunksMutex);
+                    if (chunks.find(pos) != chunks.end()) return;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(loadingMutex);
+                    if (loading.find(pos) != loading.end()) return;
+                }
+                entering.push_back(pos);
+            });
+            totalNs += elapsedNs(begin, Clock::now());
+
+            // Apply the delta outside the timed region
+            for (const auto& pos : leaving) chunks.erase(pos);
+            for (const auto& pos : entering) chunks[pos] = 0;
+            result.cubeCandidates = candidates;
+            sink = sink + leaving.size() + entering.size();
+        }
+        result.cubeScanMs = totalNs / crossings / 1e6;
+    }
+
+    // Column model: cylinder with a clamped vertical radius, per-column section masks
+    {
+        ChunkLoadVolume volume;
+        volume.horizontalRadius = radius;
+        volume.verticalRadius = verticalRadius;
+
+        ChunkColumnMap columns;
+        std::vector<glm::ivec3> initial;
+        volume.collectMissingSections(start, columns, initial);
+        for (const auto& pos : initial) {
+            columns[glm::ivec2(pos.x, pos.z)].presentSections |= ChunkColumn::sectionBit(pos.y);
+        }
+
+        glm::ivec3 center = start;
+        double totalNs = 0.0;
+        for (int i = 0; i < crossings; ++i) {
+            center += step;
+            std::vector<glm::ivec3> leaving;
+            std::vector<glm::ivec3> entering;
+
+            auto begin = Clock::now();
+            volume.collectLeavingSections(center, columns, leaving);
+            volume.collectMissingSections(center, columns, entering);
+            totalNs += elapsedNs(begin, Clock::now());
+
+            result.columnsVisited = columns.size();
+            for (const auto& pos : leaving) {
+                auto it = columns.find(glm::ivec2(pos.x, pos.z));
+                it->second.presentSections &= ~ChunkColumn::sectionBit(pos.y);
+                if (it->second.isEmpty()) columns.erase(it);
+            }
+            for (const auto& pos : entering) {
+                columns[glm::ivec2(pos.x, pos.z)].presentSections |= ChunkColumn::sectionBit(pos.y);
+            }
+            result.sectionsEntering = entering.size();
+            result.sectionsLeaving = leaving.size();
+            sink = sink + leaving.size() + entering.size();
+        }
+        result.columnScanMs = totalNs / crossings / 1e6;
+    }
+
+    // Ring delta: only the difference between the old and new cylinders is visited
+    {
+        ChunkLoadVolume volume;
+        volume.horizontalRadius = radius;
+        volume.verticalRadius = verticalRadius;
+
+        ChunkColumnMap columns;
+        std::vector<glm::ivec3> initial;
+        volume.collectMissingSections(start, columns, initial);
+        for (const auto& pos : initial) {
+            columns[glm::ivec2(pos.x, pos.z)].presentSections |= ChunkColumn::sectionBit(pos.y);
+        }
+
+        glm::ivec3 center = start;
+        double totalNs = 0.0;
+        for (int i = 0; i < crossings; ++i) {
+            glm::ivec3 oldCenter = center;
+            center += step;
+            std::vector<glm::ivec3> leaving;
+            std::vector<glm::ivec3> entering;
+
+            auto begin = Clock::now();
+            volume.collectDelta(oldCenter, center, columns, entering, leaving);
+            totalNs += elapsedNs(begin, Clock::now());
+
+            for (const auto& pos : leaving) {
+                auto it = columns.find(glm::ivec2(pos.x, pos.z));
+                it->second.presentSections &= ~ChunkColumn::sectionBit(pos.y);
+                if (it->second.isEmpty()) columns.erase(it);
+            }
+            for (const auto& pos : entering) {
+                columns[glm::ivec2(pos.x, pos.z)].presentSections |= ChunkColumn::sectionBit(pos.y);
+            }
+
+            if (entering.size() != result.sectionsEntering || leaving.size() != result.sectionsLeaving) {
+                LOG_WARN("Ring delta disagrees with column scan: %zu/%zu vs %zu/%zu sections",
+                         entering.size(), leaving.size(), result.sectionsEntering, result.sectionsLeaving);
+            }
+            sink = sink + leaving.size() + entering.size();
+        }
+        result.deltaScanMs = totalNs / crossings / 1e6;
+    }
+
+    LOG_INFO("Chunk crossing benchmark R=%d (vertical %d): cube scan %.3f ms (%zu candidates), "
+             "column scan %.3f ms (%zu columns), ring delta %.3f ms, %zu entering / %zu leaving sections",
+             radius, verticalRadius, result.cubeScanMs, result.cubeCandidates,
+             result.columnScanMs, result.columnsVisited, result.deltaScanMs,
+             result.sectionsEntering, result.sectionsLeaving);
+
+    return result;
+}
+
+ChunkLookupContentionResult runChunkLookupContentionBenchmark(int readerThreads, int durationMs) {
+    ChunkLookupContentionResult result;
+    result.readerThreads = readerThreads;
+
+    // A loaded window of 17x9x17 chunks around the origin
+    constexpr int RADIUS = 8;
+    constexpr int VERTICAL = 4;
+    constexpr int SWAPS_PER_FRAME = 32;
+    std::vector<glm::ivec3> positions;
+    for (int x = -RADIUS; x <= RADIUS; ++x) {
+        for (int y = -VERTICAL; y <= VERTICAL; ++y) {
+            for (int z = -RADIUS; z <= RADIUS; ++z) {
+                positions.emplace_back(x, y, z);
+            }
+        }
+    }
+
+    // Random block inside the window, same mapping for both containers
+    auto blockFor = [](uint32_t state) {
+        glm::ivec3 block(state & 15, (state >> 4) & 15, (state >> 8) & 15);
+        glm::ivec3 chunkPos(static_cast<int>((state >> 12) % (2 * RADIUS + 1)) - RADIUS,
+                            static_cast<int>((state >> 17) % (2 * VERTICAL + 1)) - VERTICAL,
+                            static_cast<int>((state >> 21) % (2 * RADIUS + 1)) - RADIUS);
+        return std::make_pair(chunkPos, block);
+    };
+
+    const double durationNs = durationMs * 1e6;
+
+    // Previous model: unordered_map guarded by a shared_mutex
+    {
+        std::unordered_map<glm::ivec3, std::unique_ptr<Chunk>> chunks;
+        std::shared_mutex mutex;
+        for (const auto& pos : positions) {
+            chunks[pos] = makeLayeredChunk(pos);
+        }
+
+        size_t cursor = 0;
+        result.mapLookups = runContention(readerThreads, durationMs,
+            [&](uint32_t state) -> size_t {
+                auto [chunkPos, block] = blockFor(state);
+                std::shared_lock<std::shared_mutex> lock(mutex);
+                auto it = chunks.find(chunkPos);
+                return it != chunks.end() ? it->second->getBlock(block.x, block.y, block.z) : 0;
+            },
+            [&]() {
+                for (int i = 0; i < SWAPS_PER_FRAME; ++i) {
+                    const glm::ivec3& pos = positions[cursor++ % positions.size()];
+                    auto replacement = makeLayeredChunk(pos);
+                    {
+                        std::unique_lock<std::shared_mutex> lock(mutex);
+                        chunks.erase(pos);
+                    }
+                    std::unique_lock<std::shared_mutex> lock(mutex);
+                    chunks[pos] = std::move(replacement);
+                }
+                result.mapSwaps += SWAPS_PER_FRAME;
+            });
+    }
+
+    // Lock-free directory with epoch reclamation
+    {
+        ChunkDirectory chunks;
+        for (const auto& pos : positions) {
+            chunks.insert(makeLayeredChunk(pos));
+        }
+
+        size_t cursor = 0;
+        result.directoryLookups = runContention(readerThreads, durationMs,
+            [&](uint32_t state) -> size_t {
+                auto [chunkPos, block] = blockFor(state);
+                EpochReclaimer::Guard guard;
+                const Chunk* chunk = chunks.find(chunkPos);
+                return chunk ? chunk->getBlock(block.x, block.y, block.z) : 0;
+            },
+            [&]() {
+                for (int i = 0; i < SWAPS_PER_FRAME; ++i) {
+                    const glm::ivec3& pos = positions[cursor++ % positions.size()];
+                    auto replacement = makeLayeredChunk(pos);
+                    chunks.erase(pos);
+                    chunks.insert(std::move(replacement));
+                }
+                EpochReclaimer::get().collect();
+                result.directorySwaps += SWAPS_PER_FRAME;
+            });
+        EpochReclaimer::get().collect();
+    }
+
+    if (result.mapLookups > 0) {
+        result.mapLookupNs = durationNs * readerThreads / result.mapLookups;
+    }
+    if (result.directoryLookups > 0) {
+        result.directoryLookupNs = durationNs * readerThreads / result.directoryLookups;
+    }
+
+    LOG_INFO("Chunk lookup contention (%d readers, %d ms): map + shared_mutex %.1f ns/lookup (%zu swaps), "
+             "lock-free directory %.1f ns/lookup (%zu swaps)",
+             readerThreads, durationMs, result.mapLookupNs, result.mapSwaps,
+             result.directoryLookupNs, result.directorySwaps);
+
+    return result;
+}
+
+CollisionQueryResult runCollisionQueryBenchmark(const ChunkManager& chunkManager, const glm::vec3& center,
+                                                const glm::vec3& halfExtent, int iterations) {
+    CollisionQueryResult result;
+
+    const glm::ivec3 minBlock = glm::floor(center - halfExtent);
+    const glm::ivec3 maxBlock = glm::floor(center + halfExtent);
+    const glm::ivec3 size = maxBlock - minBlock + glm::ivec3(1);
+    result.blocksPerQuery = static_cast<size_t>(size.x) * size.y * size.z;
+
+    std::vector<BlockType> perBlock(result.blocksPerQuery);
+    std::vector<BlockType> region(result.blocksPerQuery);
+    volatile size_t sink = 0;
+
+    // Previous path: a getBlock per block, as CollisionSystem::getBlockAABBsInRegion did
+    {
+        auto begin = Clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            size_t solid = 0;
+            size_t index = 0;
+            for (int z = minBlock.z; z <= maxBlock.z; ++z) {
+                for (int y = minBlock.y; y <= maxBlock.y; ++y) {
+                    for (int x = minBlock.x; x <= maxBlock.x; ++x) {
+                        BlockType type = chunkManager.getBlock(glm::vec3(x, y, z));
+                        perBlock[index++] = type;
+                        if (type != Blocks::AIR && Blocks::hasCollision(type)) solid++;
+                    }
+                }
+            }
+            sink = sink + solid;
+            result.solidBlocks = solid;
+        }
+        result.perBlockNs = elapsedNs(begin, Clock::now()) / iterations;
+    }
+
+    // Region copy: each touched chunk resolved once
+    {
+        auto begin = Clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            chunkManager.copyRegion(minBlock, maxBlock, std::span<BlockType>(region));
+            size_t solid = 0;
+            for (BlockType type : region) {
+                if (type != Blocks::AIR && Blocks::hasCollision(type)) solid++;
+            }
+            sink = sink + solid;
+        }
+        result.regionNs = elapsedNs(begin, Clock::now()) / iterations;
+    }
+
+    result.resultsMatch = perBlock == region;
+
+    LOG_INFO("Collision query benchmark (%zu blocks, %zu solid): per-block getBlock %.1f ns, copyRegion %.1f ns%s",
+             result.blocksPerQuery, result.solidBlocks, result.perBlockNs, result.regionNs,
+             result.resultsMatch ? "" : " - RESULTS DIFFER");
+
+    return result;
+}
+
+FacePackingResult runFacePackingBenchmark(int faceCount) {
+    using FaceInstance = BlockbenchInstanceGenerator::FaceInstance;
+
+    FacePackingResult result;
+    result.faces = static_cast<size_t>(faceCount);
+    result.unpackedBytes = result.faces * sizeof(FaceInstance);
+    result.packedBytes = result.faces * sizeof(PackedFace);
+
+    // Faces as the meshers emit them: 1/16 block positions inside the chunk, merged
+    // quad sizes up to a chunk, tiled pixel UVs and AO at the four 0fps.net levels
+    std::mt19937 rng(1234);
+    auto gridValue = [&rng](int maxUnits, float scale) {
+        return static_cast<float>(std::uniform_int_distribution<int>(0, maxUnits)(rng)) / scale;
+    };
+    const glm::ivec3 chunkOrigin(-37 * Chunk::CHUNK_SIZE, 5 * Chunk::CHUNK_SIZE, 12 * Chunk::CHUNK_SIZE);
+
+    std::vector<FaceInstance> faces;
+    faces.reserve(result.faces);
+    for (int i = 0; i < faceCount; ++i) {
+        int direction = std::uniform_int_distribution<int>(0, 5)(rng);
+        glm::quat rotation = BlockbenchInstanceGenerator::Generator::createFaceRotation(direction);
+        glm::vec3 local(gridValue(Chunk::CHUNK_SIZE * 16, 16.0f), gridValue(Chunk::CHUNK_SIZE * 16, 16.0f),
+                        gridValue(Chunk::CHUNK_SIZE * 16, 16.0f));
+        uint32_t textureLayer = i % 97 == 0 ? PackedFace::MISSING_TEXTURE_LAYER
+                                            : std::uniform_int_distribution<uint32_t>(0, 4000)(rng);
+        faces.emplace_back(glm::vec3(chunkOrigin) + local,
+                           glm::vec4(rotation.x, rotation.y, rotation.z, rotation.w),
+                           glm::vec3(gridValue(Chunk::CHUNK_SIZE * 16, 16.0f), gridValue(Chunk::CHUNK_SIZE * 16, 16.0f), 1.0f),
+                           direction,
+                           glm::vec4(gridValue(64, 4.0f), gridValue(64, 4.0f), gridValue(2048, 4.0f), gridValue(2048, 4.0f)),
+                           textureLayer, RenderLayer::OPAQUE,
+                           glm::vec4(gridValue(3, 3.0f), gridValue(3, 3.0f), gridValue(3, 3.0f), gridValue(3, 3.0f)));
+    }
+
+    std::vector<PackedFace> packed(result.faces);
+    auto begin = Clock::now();
+    for (size_t i = 0; i < result.faces; ++i) {
+        packed[i] = PackedFace::pack(faces[i], chunkOrigin);
+    }
+    result.packNs = elapsedNs(begin, Clock::now()) / faceCount;
+
+    std::vector<FaceInstance> unpacked(result.faces);
+    begin = Clock::now();
+    for (size_t i = 0; i < result.faces; ++i) {
+        unpacked[i] = packed[i].unpack(chunkOrigin);
+    }
+    result.unpackNs = elapsedNs(begin, Clock::now()) / faceCount;
+
+    auto near = [](const auto& a, const auto& b) {
+        using Vec = std::decay_t<decltype(a)>;
+        return glm::all(glm::lessThan(glm::abs(a - b), Vec(1e-4f)));
+    };
+    for (size_t i = 0; i < result.faces; ++i) {
+        const FaceInstance& a = faces[i];
+        const FaceInstance& b = unpacked[i];
+        bool same = near(a.position, b.position) && near(a.rotation, b.rotation) && near(a.scale, b.scale) &&
+                    a.faceDirection == b.faceDirection && near(a.uv, b.uv) && near(a.ao, b.ao) &&
+                    a.textureLayer == b.textureLayer;
+        if (!same) {
+            result.mismatches++;
+        }
+    }
+
+    LOG_INFO("Face packing benchmark (%zu faces): %zu B -> %zu B (%.1fx smaller), pack %.1f ns, unpack %.1f ns, "
+             "%zu round-trip mismatches",
+             result.faces, result.unpackedBytes, result.packedBytes,
+             static_cast<double>(result.unpackedBytes) / static_cast<double>(result.packedBytes),
+             result.packNs, result.unpackNs, result.mismatches);
+
+    return result;
+}
+
+FaceVisibilityResult runFaceVisibilityBenchmark(int iterations) {
+    FaceVisibilityResult result;
+
+    // Scenes that exercise every culling rule: opaque terrain, a lake with a glass
+    // wall, slabs and stairs, and per-block noise mixing all of them
+    const std::array<BlockType, 8> noisePalette = {
+        Blocks::AIR, Blocks::AIR, Blocks::STONE, Blocks::GLASS,
+        Blocks::WATER, Blocks::OAK_LEAVES, Blocks::OAK_SLAB, Blocks::OAK_STAIRS
+    };
+    auto sceneBlock = [&](int scene, const glm::ivec3& world, uint32_t noise) -> BlockType {
+        switch (scene) {
+            case 0:
+                return layeredBlock(world.y);
+            case 1:
+                if (world.y < 6) return Blocks::STONE;
+                if (world.x == 7) return Blocks::GLASS;
+                return world.y < 12 ? Blocks::WATER : Blocks::AIR;
+            case 2:
+                if (world.y < 4) return Blocks::STONE;
+                if (world.y == 4) return (world.x + world.z) % 3 == 0 ? Blocks::OAK_STAIRS : Blocks::OAK_SLAB;
+                return world.y < 8 && world.x % 4 == 0 ? Blocks::OAK_LEAVES : Blocks::AIR;
+            default:
+                return noisePalette[noise % noisePalette.size()];
+        }
+    };
+
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    std::vector<ExtendedChunkData> snapshots;
+    uint32_t state = 0x2545F491u;
+    for (int scene = 0; scene < 4; ++scene) {
+        // Center chunk plus its six face neighbors, filled from world coordinates so borders line up
+        auto makeChunk = [&](const glm::ivec3& chunkPos) {
+            auto chunk = std::make_unique<Chunk>(chunkPos);
+            for (int z = 0; z < Chunk::CHUNK_SIZE; ++z) {
+                for (int y = 0; y < Chunk::CHUNK_SIZE; ++y) {
+                    for (int x = 0; x < Chunk::CHUNK_SIZE; ++x) {
+                        state ^= state << 13;
+                        state ^= state >> 17;
+                        state ^= state << 5;
+                        glm::ivec3 world = chunkPos * Chunk::CHUNK_SIZE + glm::ivec3(x, y, z);
+                        chunk->setBlock(x, y, z, sceneBlock(scene, world, state >> 8));
+                    }
+                }
+            }
+            chunks.push_back(std::move(chunk));
+            return chunks.back().get();
+        };
+
+        const Chunk* center = makeChunk(glm::ivec3(0));
+        ChunkNeighborhood neighborhood(*center);
+        for (const glm::ivec3& offset : {glm::ivec3(-1, 0, 0), glm::ivec3(1, 0, 0), glm::ivec3(0, -1, 0),
+                                         glm::ivec3(0, 1, 0), glm::ivec3(0, 0, -1), glm::ivec3(0, 0, 1)}) {
+            neighborhood.setNeighbor(offset, makeChunk(offset));
+        }
+        snapshots.emplace_back(neighborhood);
+    }
+    result.chunks = snapshots.size();
+
+    // Both generators must agree on every row of every direction
+    for (const auto& snapshot : snapshots) {
+        FaceVisibilityMask reference = FaceVisibilityMaskGenerator::generateMaskPerVoxel(snapshot);
+        FaceVisibilityMask bitwise = FaceVisibilityMaskGenerator::generateMask(snapshot);
+        result.visibleFaces += bitwise.getTotalVisibleFaces();
+        for (int dir = 0; dir < 6; ++dir) {
+            auto direction = static_cast<FaceVisibilityMask::FaceDirection>(dir);
+            for (int z = 0; z < Chunk::CHUNK_SIZE; ++z) {
+                for (int y = 0; y < Chunk::CHUNK_SIZE; ++y) {
+                    if (reference.getRowVisible(y, z, direction) != bitwise.getRowVisible(y, z, direction)) {
+                        result.mismatchedRows++;
+                    }
+                }
+            }
+        }
+    }
+
+    const double runs = static_cast<double>(iterations) * snapshots.size();
+    volatile size_t sink = 0;
+
+    auto start = Clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        for (const auto& snapshot : snapshots) {
+            sink = sink + FaceVisibilityMaskGenerator::generateMaskPerVoxel(snapshot).getTotalVisibleFaces();
+        }
+    }
+    result.perVoxelUs = elapsedNs(start, Clock::now()) / runs / 1000.0;
+
+    start = Clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        for (const auto& snapshot : snapshots) {
+            sink = sink + FaceVisibilityMaskGenerator::generateMask(snapshot).getTotalVisibleFaces();
+        }
+    }
+    result.bitwiseUs = elapsedNs(start, Clock::now()) / runs / 1000.0;
+
+    LOG_INFO("Face visibility benchmark (%zu chunks x %d): per-voxel %.1f us, bitwise %.1f us (%.1fx), "
+             "%zu visible faces, %zu mismatched rows",
+             result.chunks, iterations, result.perVoxelUs, result.bitwiseUs,
+             result.bitwiseUs > 0.0 ? result.perVoxelUs / result.bitwiseUs : 0.0,
+             result.visibleFaces, result.mismatchedRows);
+
+    return result;
+}
+
+GreedyMeshingResult runGreedyMeshingBenchmark(const ChunkManager& chunkManager, const glm::vec3& center, int radius) {
+    GreedyMeshingResult result;
+
+    const ChunkMeshGenerator* meshGenerator = chunkManager.getMeshGenerator();
+    if (!meshGenerator) {
+        LOG_WARN("Greedy meshing benchmark: no mesh generator");
+        return result;
+    }
+
+    const std::vector<ExtendedChunkData> snapshots = snapshotChunksAround(chunkManager, center, radius);
+    result.chunks = snapshots.size();
+    if (snapshots.empty()) {
+        LOG_INFO("Greedy meshing benchmark: no loaded chunks around the player");
+        return result;
+    }
+
+    double perBlockNs = 0.0;
+    double greedyNs = 0.0;
+    for (const auto& snapshot : snapshots) {
+        auto start = Clock::now();
+        LayeredChunkMesh perBlock = meshGenerator->generateChunkMeshPerBlock(snapshot);
+        perBlockNs += elapsedNs(start, Clock::now());
+
+        start = Clock::now();
+        LayeredChunkMesh greedy = meshGenerator->generateChunkMeshGreedy(snapshot);
+        greedyNs += elapsedNs(start, Clock::now());
+
+        for (size_t layer = 0; layer < RENDER_LAYER_COUNT; ++layer) {
+            auto area = [](const LayeredChunkMesh::FaceList& faces) {
+                double total = 0.0;
+                for (const auto& face : faces) {
+                    total += static_cast<double>(face.scale.x) * face.scale.y;
+                }
+                return total;
+            };
+            if (std::abs(area(perBlock.layers[layer]) - area(greedy.layers[layer])) > 1e-3) {
+                result.areaMatches = false;
+            }
+            result.perBlockFaces += perBlock.layers[layer].size();
+            result.greedyFaces += greedy.layers[layer].size();
+        }
+    }
+    result.perBlockMs = perBlockNs / static_cast<double>(result.chunks) / 1e6;
+    result.greedyMs = greedyNs / static_cast<double>(result.chunks) / 1e6;
+
+    LOG_INFO("Greedy meshing benchmark (%zu chunks): per-block %zu faces in %.3f ms, greedy %zu faces in %.3f ms "
+             "per chunk (%.1fx fewer faces)%s",
+             result.chunks, result.perBlockFaces, result.perBlockMs, result.greedyFaces, result.greedyMs,
+             result.greedyFaces > 0 ? static_cast<double>(result.perBlockFaces) / result.greedyFaces : 0.0,
+             result.areaMatches ? "" : " - FACE AREA DIFFERS");
+
+    return result;
+}
+
+MeshingAOResult runMeshingAOBenchmark(const ChunkManager& chunkManager, const glm::vec3& center, int radius) {
+    MeshingAOResult result;
+    result.threads = static_cast<int>(std::max(2u, std::thread::hardware_concurrency()));
+
+    const ChunkMeshGenerator* meshGenerator = chunkManager.getMeshGenerator();
+    if (!meshGenerator) {
+        LOG_WARN("Meshing AO benchmark: no mesh generator");
+        return result;
+    }
+
+    const std::vector<ExtendedChunkData> snapshots = snapshotChunksAround(chunkManager, center, radius);
+    result.chunks = snapshots.size();
+    if (snapshots.empty()) {
+        LOG_INFO("Meshing AO benchmark: no loaded chunks around the player");
+        return result;
+    }
+
+    // Visible faces per chunk, so both AO variants do the same work
+    std::vector<FaceVisibilityMask> visibility;
+    visibility.reserve(snapshots.size());
+    for (const auto& snapshot : snapshots) {
+        visibility.push_back(FaceVisibilityMaskGenerator::generateMask(snapshot));
+        result.faces += visibility.back().getTotalVisibleFaces();
+    }
+
+    auto forEachVisibleRow = [&](size_t chunk, auto&& rowFn) {
+        for (int dir = 0; dir < 6; ++dir) {
+            const auto direction = static_cast<FaceVisibilityMask::FaceDirection>(dir);
+            for (int z = 0; z < Chunk::CHUNK_SIZE; ++z) {
+                for (int y = 0; y < Chunk::CHUNK_SIZE; ++y) {
+                    const uint16_t row = visibility[chunk].getRowVisible(y, z, direction);
+                    if (row != 0) {
+                        rowFn(dir, y, z, row);
+                    }
+                }
+            }
+        }
+    };
+
+    // Previous path: 12 ChunkManager::getBlock calls per face
+    std::vector<std::vector<glm::vec4>> worldAO(snapshots.size());
+    auto worldQueryAO = [&](size_t chunk) {
+        const glm::ivec3 chunkWorldPos = snapshots[chunk].getChunkPosition() * Chunk::CHUNK_SIZE;
+        worldAO[chunk].clear();
+        forEachVisibleRow(chunk, [&](int dir, int y, int z, uint16_t row) {
+            for (uint32_t bits = row; bits != 0; bits &= bits - 1) {
+                const int x = std::countr_zero(bits);
+                worldAO[chunk].push_back(VoxelAO::calculateFaceAO(&chunkManager, chunkWorldPos, x, y, z, dir));
+            }
+        });
+    };
+
+    // Meshing path: occluder masks of the snapshot, a row of faces at a time
+    std::vector<std::vector<glm::vec4>> snapshotAO(snapshots.size());
+    auto snapshotRowAO = [&](size_t chunk) {
+        const OccupancyMasks occupancy(snapshots[chunk]);
+        snapshotAO[chunk].clear();
+        forEachVisibleRow(chunk, [&](int dir, int y, int z, uint16_t row) {
+            const VoxelAO::RowAO rowAO = VoxelAO::calculateRowAO(occupancy, y, z, dir);
+            for (uint32_t bits = row; bits != 0; bits &= bits - 1) {
+                snapshotAO[chunk].push_back(VoxelAO::getFaceAO(rowAO, std::countr_zero(bits)));
+            }
+        });
+    };
+
+    std::atomic<size_t> meshedFaces{0};
+    auto meshChunk = [&](size_t chunk) {
+        const LayeredChunkMesh mesh = meshGenerator->generateChunkMeshExtended(snapshots[chunk]);
+        size_t faces = 0;
+        for (const auto& layer : mesh.layers) {
+            faces += layer.size();
+        }
+        meshedFaces.fetch_add(faces, std::memory_order_relaxed);
+    };
+
+    result.worldAOMs = runParallel(snapshots.size(), 1, worldQueryAO);
+    result.worldAOThreadedMs = runParallel(snapshots.size(), result.threads, worldQueryAO);
+    result.snapshotAOMs = runParallel(snapshots.size(), 1, snapshotRowAO);
+    result.snapshotAOThreadedMs = runParallel(snapshots.size(), result.threads, snapshotRowAO);
+    result.meshMs = runParallel(snapshots.size(), 1, meshChunk);
+    result.meshThreadedMs = runParallel(snapshots.size(), result.threads, meshChunk);
+
+    // Faces next to unloaded chunks may differ: the snapshot mirrors the chunk's
+    // own border there while the world reads air
+    for (size_t chunk = 0; chunk < snapshots.size(); ++chunk) {
+        for (size_t i = 0; i < worldAO[chunk].size(); ++i) {
+            const glm::vec4& world = worldAO[chunk][i];
+            const glm::vec4& local = snapshotAO[chunk][i];
+            for (int vertex = 0; vertex < 4; ++vertex) {
+                if (PackedFace::aoLevel(world[vertex]) != PackedFace::aoLevel(local[vertex])) {
+                    result.aoMismatches++;
+                    break;
+                }
+            }
+        }
+    }
+
+    LOG_INFO("Meshing AO benchmark (%zu chunks, %zu faces, 1/%d threads): world-query AO %.2f/%.2f ms, "
+             "snapshot AO %.2f/%.2f ms, full meshing %.2f/%.2f ms, %zu faces with different AO",
+             result.chunks, result.faces, result.threads, result.worldAOMs, result.worldAOThreadedMs,
+             result.snapshotAOMs, result.snapshotAOThreadedMs, result.meshMs, result.meshThreadedMs,
+             result.aoMismatches);
+
+    return result;
+}
+
+IncrementalRemeshResult runIncrementalRemeshBenchmark(const ChunkManager& chunkManager, const glm::vec3& center,
+                                                      int radius, int editsPerChunk) {
+    IncrementalRemeshResult result;
+
+    const ChunkMeshGenerator* meshGenerator = chunkManager.getMeshGenerator();
+    if (!meshGenerator) {
+        LOG_WARN("Incremental remesh benchmark: no mesh generator");
+        return result;
+    }
+
+    std::vector<ExtendedChunkData> snapshots = snapshotChunksAround(chunkManager, center, radius);
+    result.chunks = snapshots.size();
+    if (snapshots.empty()) {
+        LOG_INFO("Incremental remesh benchmark: no loaded chunks around the player");
+        return result;
+    }
+
+    auto meshFully = [meshGenerator](const ExtendedChunkData& snapshot) {
+        const OccupancyMasks occupancy(snapshot);
+        const FaceVisibilityMask visibilityMask = FaceVisibilityMaskGenerator::generateMask(snapshot, occupancy);
+        return meshGenerator->generateChunkMeshExtended(snapshot, occupancy, visibilityMask)
+            .pack(snapshot.getChunkPosition() * Chunk::CHUNK_SIZE);
+    };
+
+    auto sameMesh = [](const ChunkMesh& a, const ChunkMesh& b) {
+        auto sameFace = [](const PackedFace& x, const PackedFace& y) {
+            return x.position == y.position && x.shape == y.shape && x.uvMin == y.uvMin && x.uvMax == y.uvMax;
+        };
+        return a.layerCounts == b.layerCounts && a.sliceCounts == b.sliceCounts &&
+               std::equal(a.faces.begin(), a.faces.end(), b.faces.begin(), b.faces.end(), sameFace);
+    };
+
+    // What ChunkManager::generateMeshForChunk does with a snapshot: skip on a hash hit,
+    // splice the dirty slices into previous when it can, and stamp only full meshes
+    auto remesh = [&](const ExtendedChunkData& snapshot, const ChunkMesh& previous, const ChunkSliceMask& dirtySlices) {
+        const OccupancyMasks occupancy(snapshot);
+        const FaceVisibilityMask visibilityMask = FaceVisibilityMaskGenerator::generateMask(snapshot, occupancy);
+        const uint64_t inputHash = meshGenerator->computeMeshInputHash(snapshot, occupancy, visibilityMask);
+        if (previous.inputHash != 0 && previous.inputHash == inputHash) {
+            return previous;
+        }
+        std::optional<ChunkMesh> incremental = meshGenerator->generateChunkMeshIncremental(
+            snapshot, occupancy, visibilityMask, previous, dirtySlices);
+        if (incremental) {
+            return std::move(*incremental);
+        }
+        ChunkMesh full = meshGenerator->generateChunkMeshExtended(snapshot, occupancy, visibilityMask)
+            .pack(snapshot.getChunkPosition() * Chunk::CHUNK_SIZE);
+        full.inputHash = inputHash;
+        return full;
+    };
+
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> coordinate(0, Chunk::CHUNK_SIZE - 1);
+    std::uniform_int_distribution<int> farOffset(3, Chunk::CHUNK_SIZE - 3);
+    auto toggleBlock = [](ExtendedChunkData& snapshot, const glm::ivec3& block) {
+        const BlockType old = snapshot.getBlock(block.x, block.y, block.z);
+        snapshot.setBlock(block.x, block.y, block.z, old == Blocks::AIR ? Blocks::STONE : Blocks::AIR);
+    };
+    double fullNs = 0.0;
+    double incrementalNs = 0.0;
+
+    for (auto& snapshot : snapshots) {
+        ChunkMesh previous = meshFully(snapshot);
+        for (int edit = 0; edit < editsPerChunk; ++edit) {
+            // Break a block or fill air, like a player would
+            const glm::ivec3 block(coordinate(rng), coordinate(rng), coordinate(rng));
+            toggleBlock(snapshot, block);
+
+            auto start = Clock::now();
+            ChunkMesh full = meshFully(snapshot);
+            fullNs += elapsedNs(start, Clock::now());
+
+            start = Clock::now();
+            const OccupancyMasks occupancy(snapshot);
+            const FaceVisibilityMask visibilityMask = FaceVisibilityMaskGenerator::generateMask(snapshot, occupancy);
+            std::optional<ChunkMesh> incremental = meshGenerator->generateChunkMeshIncremental(
+                snapshot, occupancy, visibilityMask, previous, ChunkMeshGenerator::getSlicesAround(block));
+            incrementalNs += elapsedNs(start, Clock::now());
+
+            result.edits++;
+            if (!incremental) {
+                result.fallbacks++;
+            } else if (!sameMesh(*incremental, full)) {
+                result.mismatches++;
+            }
+            previous = std::move(full);
+        }
+        
+        // A second edit lands after the first one's remesh was queued but before the
+        // worker snapshots the chunk, at least 3 blocks away on every axis so its
+        // slices are not dirty. The spliced mesh keeps them stale, and the follow-up
+        // remesh the second edit queued must rebuild them rather than trust a hash
+        for (int edit = 0; edit < editsPerChunk; ++edit) {
+            const OccupancyMasks occupancy(snapshot);
+            const FaceVisibilityMask visibilityMask = FaceVisibilityMaskGenerator::generateMask(snapshot, occupancy);
+            ChunkMesh base = meshGenerator->generateChunkMeshExtended(snapshot, occupancy, visibilityMask)
+                .pack(snapshot.getChunkPosition() * Chunk::CHUNK_SIZE);
+            base.inputHash = meshGenerator->computeMeshInputHash(snapshot, occupancy, visibilityMask);
+            
+            const glm::ivec3 first(coordinate(rng), coordinate(rng), coordinate(rng));
+            const glm::ivec3 second = (first + glm::ivec3(farOffset(rng), farOffset(rng), farOffset(rng))) %
+                                      Chunk::CHUNK_SIZE;
+            toggleBlock(snapshot, first);
+            toggleBlock(snapshot, second);
+            
+            const ChunkMesh spliced = remesh(snapshot, base, ChunkMeshGenerator::getSlicesAround(first));
+            const ChunkMesh followUp = remesh(snapshot, spliced, ChunkMeshGenerator::getSlicesAround(second));
+            
+            result.interleavedEdits++;
+            if (!sameMesh(followUp, meshFully(snapshot))) {
+                result.interleavedMismatches++;
+            }
+        }
+    }
+    result.fullMs = fullNs / static_cast<double>(result.edits) / 1e6;
+    result.incrementalMs = incrementalNs / static_cast<double>(result.edits) / 1e6;
+
+    LOG_INFO("Incremental remesh benchmark (%zu chunks, %zu edits): full %.3f ms, incremental %.3f ms per edit "
+             "(%.1fx), %zu fallbacks, %zu mismatches, %zu/%zu interleaved edits mismatched",
+             result.chunks, result.edits, result.fullMs, result.incrementalMs,
+             result.incrementalMs > 0.0 ? result.fullMs / result.incrementalMs : 0.0,
+             result.fallbacks, result.mismatches, result.interleavedMismatches, result.interleavedEdits);
+
+    return result;
+}
+
+MeshAllocationResult runMeshAllocationBenchmark(const ChunkManager& chunkManager, const glm::vec3& center,
+                                                int radius, int passes) {
+    MeshAllocationResult result;
+    result.threads = static_cast<int>(std::max(8u, std::thread::hardware_concurrency()));
+
+    const ChunkMeshGenerator* meshGenerator = chunkManager.getMeshGenerator();
+    if (!meshGenerator) {
+        return result;
+    }
+
+    const std::vector<ExtendedChunkData> snapshots = snapshotChunksAround(chunkManager, center, radius);
+    result.chunks = snapshots.size();
+    if (snapshots.empty()) {
+        LOG_INFO("Mesh allocation benchmark: no loaded chunks around the player");
+        return result;
+    }
+
+    // The mesh task body: masks, mesh, pack; only the packed mesh is kept
+    std::atomic<size_t> faces{0};
+    auto meshChunk = [&](const ExtendedChunkData& snapshot, std::pmr::memory_resource* resource) {
+        const OccupancyMasks occupancy(snapshot);
+        const FaceVisibilityMask visibilityMask = FaceVisibilityMaskGenerator::generateMask(snapshot, occupancy);
+        const ChunkMesh mesh = meshGenerator->generateChunkMeshExtended(snapshot, occupancy, visibilityMask, resource)
+                                   .pack(snapshot.getChunkPosition() * Chunk::CHUNK_SIZE);
+        faces.fetch_add(mesh.faces.size(), std::memory_order_relaxed);
+    };
+
+    CountingResource heap;
+    auto heapChunk = [&](size_t i) {
+        meshChunk(snapshots[i % snapshots.size()], &heap);
+    };
+
+    std::atomic<size_t> arenaOverflows{0};
+    auto arenaChunk = [&](size_t i) {
+        ScratchArena::Scope scratch;
+        const size_t overflowsBefore = ScratchArena::get().getStats().overflowAllocations;
+        meshChunk(snapshots[i % snapshots.size()], scratch.resource());
+        arenaOverflows.fetch_add(ScratchArena::get().getStats().overflowAllocations - overflowsBefore,
+                                 std::memory_order_relaxed);
+    };
+
+    // One untimed pass each warms the caches and grows the workers' arenas
+    const size_t count = snapshots.size() * static_cast<size_t>(std::max(passes, 1));
+    runParallel(snapshots.size(), result.threads, heapChunk);
+    runParallel(snapshots.size(), result.threads, arenaChunk);
+
+    const size_t heapBefore = heap.getAllocations();
+    arenaOverflows = 0;
+    result.heapMs = runParallel(count, result.threads, heapChunk);
+    result.arenaMs = runParallel(count, result.threads, arenaChunk);
+    result.heapAllocsPerChunk = static_cast<double>(heap.getAllocations() - heapBefore) / static_cast<double>(count);
+    result.arenaAllocsPerChunk = static_cast<double>(arenaOverflows.load()) / static_cast<double>(count);
+
+    LOG_INFO("Mesh allocation benchmark (%zu chunks x %d passes, %d threads): heap %.2f ms, %.1f allocations "
+             "per chunk; arena %.2f ms, %.2f allocations per chunk",
+             result.chunks, passes, result.threads, result.heapMs, result.heapAllocsPerChunk,
+             result.arenaMs, result.arenaAllocsPerChunk);
+
+    return result;
+}
+
+} // namespace Benchmarks
+} // namespace Zerith
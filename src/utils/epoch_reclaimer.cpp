@@ -0,0 +1,147 @@
+#include "epoch_reclaimer.h"
+#include "logger.h"
+#include <thread>
+
+namespace Zerith {
+
+namespace {
+
+// Per-thread slot index and guard nesting depth
+struct ThreadSlot {
+    int index = -1;
+    int depth = 0;
+    EpochReclaimer* owner = nullptr;
+    void (*release)(EpochReclaimer*, int) = nullptr;
+
+    ~ThreadSlot() {
+        if (index >= 0 && release) {
+            release(owner, index);
+        }
+    }
+};
+
+thread_local ThreadSlot t_slot;
+
+} // anonymous namespace
+
+EpochReclaimer& EpochReclaimer::get() {
+    static EpochReclaimer instance;
+    return instance;
+}
+
+EpochReclaimer::~EpochReclaimer() {
+    // No readers remain at shutdown
+    std::lock_guard<std::mutex> lock(m_retiredMutex);
+    for (const auto& retired : m_retired) {
+        retired.deleter(retired.object);
+    }
+    m_retired.clear();
+}
+
+EpochReclaimer::Guard::Guard() {
+    EpochReclaimer& reclaimer = EpochReclaimer::get();
+    ThreadRecord& record = reclaimer.getThreadRecord();
+    if (t_slot.depth++ == 0) {
+        record.epoch.store(reclaimer.m_globalEpoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+        // Orders the pin before the pointer loads that follow. A store is not
+        // ordered before later acquire loads on its own; this pairs with the
+        // fence in collect() so the scan either sees the pin or the reader
+        // sees the unlinked pointer
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+EpochReclaimer::Guard::~Guard() {
+    if (--t_slot.depth == 0) {
+        EpochReclaimer::get().m_records[t_slot.index].epoch.store(0, std::memory_order_release);
+    }
+}
+
+EpochReclaimer::ThreadRecord& EpochReclaimer::getThreadRecord() {
+    if (t_slot.index < 0) {
+        t_slot.index = claimRecord();
+        t_slot.owner = this;
+        t_slot.release = [](EpochReclaimer* reclaimer, int index) { reclaimer->releaseRecord(index); };
+    }
+    return m_records[t_slot.index];
+}
+
+int EpochReclaimer::claimRecord() {
+    bool warned = false;
+    while (true) {
+        for (int i = 0; i < MAX_THREADS; ++i) {
+            bool expected = false;
+            if (!m_records[i].claimed.load(std::memory_order_relaxed) &&
+                m_records[i].claimed.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                return i;
+            }
+        }
+
+        // Every slot is taken: wait for a reader thread to exit
+        if (!warned) {
+            LOG_WARN("EpochReclaimer: all %d reader slots in use, waiting for one to be released", MAX_THREADS);
+            warned = true;
+        }
+        std::this_thread::yield();
+    }
+}
+
+void EpochReclaimer::releaseRecord(int index) {
+    m_records[index].epoch.store(0, std::memory_order_release);
+    m_records[index].claimed.store(false, std::memory_order_release);
+}
+
+void EpochReclaimer::retireRaw(void* object, void (*deleter)(void*)) {
+    std::lock_guard<std::mutex> lock(m_retiredMutex);
+    m_retired.push_back({m_globalEpoch.load(std::memory_order_acquire), object, deleter});
+}
+
+void EpochReclaimer::collect() {
+    std::vector<RetiredObject> freeable;
+    {
+        std::lock_guard<std::mutex> lock(m_retiredMutex);
+        if (m_retired.empty()) {
+            return;
+        }
+
+        // Pairs with the fence in Guard(): objects were unlinked before this
+        // point, so any reader the scan misses can no longer reach them
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // The epoch can advance once no reader is pinned to an older one
+        uint64_t epoch = m_globalEpoch.load(std::memory_order_seq_cst);
+        bool canAdvance = true;
+        for (const auto& record : m_records) {
+            uint64_t pinned = record.epoch.load(std::memory_order_seq_cst);
+            if (pinned != 0 && pinned != epoch) {
+                canAdvance = false;
+                break;
+            }
+        }
+        if (canAdvance) {
+            epoch = m_globalEpoch.fetch_add(1, std::memory_order_acq_rel) + 1;
+        }
+
+        // Readers pinned at epoch E may hold objects retired at E or E-1 only
+        auto keep = m_retired.begin();
+        for (auto it = m_retired.begin(); it != m_retired.end(); ++it) {
+            if (it->epoch + 2 <= epoch) {
+                freeable.push_back(*it);
+            } else {
+                *keep++ = *it;
+            }
+        }
+        m_retired.erase(keep, m_retired.end());
+    }
+
+    for (const auto& retired : freeable) {
+        retired.deleter(retired.object);
+    }
+}
+
+size_t EpochReclaimer::getRetiredCount() const {
+    std::lock_guard<std::mutex> lock(m_retiredMutex);
+    return m_retired.size();
+}
+
+} // namespace Zerith
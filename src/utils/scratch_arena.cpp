@@ -0,0 +1,53 @@
+#include "scratch_arena.h"
+#include <algorithm>
+#include <bit>
+
+namespace Zerith {
+
+ScratchArena::Scope::Scope()
+    : m_arena(ScratchArena::get()) {
+    m_arena.m_scopeDepth++;
+}
+
+ScratchArena::Scope::~Scope() {
+    if (--m_arena.m_scopeDepth == 0) {
+        m_arena.reset();
+    }
+}
+
+ScratchArena& ScratchArena::get() {
+    thread_local ScratchArena arena;
+    return arena;
+}
+
+void* ScratchArena::do_allocate(size_t bytes, size_t alignment) {
+    m_stats.allocations++;
+
+    void* ptr = m_block.get() + m_used;
+    size_t space = m_blockSize - m_used;
+    if (m_block && std::align(alignment, bytes, ptr, space)) {
+        m_used = m_blockSize - space + bytes;
+        return ptr;
+    }
+
+    // Doesn't fit: take a heap block of its own, counted towards the next block size
+    m_stats.overflowAllocations++;
+    m_overflowBytes += bytes + alignment;
+    auto& block = m_overflow.emplace_back(new std::byte[bytes + alignment]);
+    ptr = block.get();
+    space = bytes + alignment;
+    return std::align(alignment, bytes, ptr, space);
+}
+
+void ScratchArena::reset() {
+    if (m_overflowBytes > 0 && m_blockSize < MAX_BLOCK_BYTES) {
+        m_blockSize = std::min(std::bit_ceil(m_used + m_overflowBytes), MAX_BLOCK_BYTES);
+        m_block.reset(new std::byte[m_blockSize]);
+        m_stats.blockBytes = m_blockSize;
+    }
+    m_overflow.clear();
+    m_overflowBytes = 0;
+    m_used = 0;
+}
+
+} // namespace Zerith
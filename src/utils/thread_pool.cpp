@@ -7,6 +7,7 @@ namespace Zerith {
 
 std::atomic<Task::TaskId> Task::s_nextId{1};
 thread_local std::mt19937 ThreadPool::s_rng{std::random_device{}()};
+thread_local Task::TaskId ThreadPool::s_currentTaskId = 0;
 std::unique_ptr<ThreadPool> g_threadPool;
 
 ThreadPool::ThreadPool(size_t numThreads) {
@@ -26,6 +27,7 @@ ThreadPool::ThreadPool(size_t numThreads) {
     for (size_t i = 0; i < numThreads; ++i) {
         m_threads.emplace_back(&ThreadPool::workerThread, this, i);
     }
+    m_interactiveThread = std::thread(&ThreadPool::interactiveWorkerThread, this);
 }
 
 ThreadPool::~ThreadPool() {
@@ -34,15 +36,20 @@ ThreadPool::~ThreadPool() {
         m_shutdown.store(true, std::memory_order_release);
     }
     m_condition.notify_all();
+    m_interactiveCondition.notify_all();
     
     for (auto& thread : m_threads) {
         if (thread.joinable()) {
             thread.join();
         }
     }
+    if (m_interactiveThread.joinable()) {
+        m_interactiveThread.join();
+    }
     
-    LOG_INFO("ThreadPool shutdown complete. Stats: completed=%llu, stolen=%llu, cancelled=%llu",
-             m_stats.tasksCompleted.load(), m_stats.tasksStolen.load(), m_stats.tasksCancelled.load());
+    LOG_INFO("ThreadPool shutdown complete. Stats: completed=%llu, stolen=%llu, cancelled=%llu, dropped=%llu",
+             m_stats.tasksCompleted.load(), m_stats.tasksStolen.load(), m_stats.tasksCancelled.load(),
+             m_stats.tasksDropped.load());
 }
 
 void ThreadPool::submitTask(Task task) {
@@ -82,6 +89,24 @@ void ThreadPool::submitTask(Task task) {
     m_condition.notify_one();
 }
 
+void ThreadPool::submitInteractiveTask(Task task) {
+    if (m_shutdown.load(std::memory_order_acquire)) {
+        return;
+    }
+    
+    {
+        std::unique_lock<std::mutex> lock(m_taskMapMutex);
+        m_taskCancellationFlags[task.getId()] = task.m_cancelled;
+    }
+    
+    {
+        std::unique_lock<std::mutex> lock(m_globalQueueMutex);
+        m_interactiveQueue.push_back(std::move(task));
+    }
+    m_interactiveCondition.notify_one();
+    m_condition.notify_one();
+}
+
 bool ThreadPool::cancelTask(Task::TaskId taskId) {
     std::unique_lock<std::mutex> lock(m_taskMapMutex);
     auto it = m_taskCancellationFlags.find(taskId);
@@ -95,6 +120,29 @@ bool ThreadPool::cancelTask(Task::TaskId taskId) {
     return false;
 }
 
+size_t ThreadPool::reprioritizeTasks(const std::function<void(Task&)>& update) {
+    std::unique_lock<std::mutex> lock(m_globalQueueMutex);
+    std::vector<Task> tasks;
+    tasks.reserve(m_globalQueue.size());
+    
+    while (!m_globalQueue.empty()) {
+        Task task = std::move(const_cast<Task&>(m_globalQueue.top()));
+        m_globalQueue.pop();
+        
+        // Every queued task is visited anyway, so cancelled ones are dropped here
+        if (task.isCancelled()) {
+            dropCancelledTask(task);
+            continue;
+        }
+        
+        update(task);
+        tasks.push_back(std::move(task));
+    }
+    
+    m_globalQueue = std::priority_queue<Task>(std::less<Task>(), std::move(tasks));
+    return m_globalQueue.size();
+}
+
 void ThreadPool::cancelTasksByPriority(TaskPriority maxPriority) {
     std::unique_lock<std::mutex> lock(m_globalQueueMutex);
     std::priority_queue<Task> newQueue;
@@ -106,6 +154,7 @@ void ThreadPool::cancelTasksByPriority(TaskPriority maxPriority) {
         if (task.getPriority() <= maxPriority) {
             task.cancel();
             m_stats.tasksCancelled.fetch_add(1, std::memory_order_relaxed);
+            dropCancelledTask(task);
         } else {
             newQueue.push(std::move(task));
         }
@@ -117,10 +166,10 @@ void ThreadPool::cancelTasksByPriority(TaskPriority maxPriority) {
 size_t ThreadPool::getPendingTaskCount() const {
     size_t count = 0;
     
-    // Count global queue
+    // Count global queue and interactive lane
     {
         std::unique_lock<std::mutex> lock(m_globalQueueMutex);
-        count += m_globalQueue.size();
+        count += m_globalQueue.size() + m_interactiveQueue.size();
     }
     
     // Count local queues
@@ -163,31 +212,17 @@ void ThreadPool::workerThread(size_t threadIndex) {
         Task task;
         auto waitStart = std::chrono::steady_clock::now();
         
-        if (tryGetTask(task, threadIndex)) {
-            auto waitEnd = std::chrono::steady_clock::now();
-            auto waitTime = std::chrono::duration_cast<std::chrono::microseconds>(waitEnd - waitStart).count();
-            
-            m_stats.activeThreads.fetch_add(1, std::memory_order_relaxed);
-            
-            auto execStart = std::chrono::steady_clock::now();
-            task.execute();
-            auto execEnd = std::chrono::steady_clock::now();
-            auto execTime = std::chrono::duration_cast<std::chrono::microseconds>(execEnd - execStart).count();
-            
-            m_stats.activeThreads.fetch_sub(1, std::memory_order_relaxed);
-            
-            updateStats(task, waitTime, execTime);
-            
-            // Clean up completed task from tracking map
-            {
-                std::unique_lock<std::mutex> lock(m_taskMapMutex);
-                m_taskCancellationFlags.erase(task.getId());
-            }
+        // The interactive lane goes ahead of everything queued
+        if (tryGetInteractiveTask(task)) {
+            runInteractiveTask(task, waitStart);
+        } else if (tryGetTask(task, threadIndex)) {
+            runTask(task, waitStart);
         } else {
             // Wait for new tasks
             std::unique_lock<std::mutex> lock(m_globalQueueMutex);
             m_condition.wait_for(lock, std::chrono::milliseconds(10), [this] {
-                return !m_globalQueue.empty() || m_shutdown.load(std::memory_order_acquire);
+                return !m_globalQueue.empty() || !m_interactiveQueue.empty() ||
+                       m_shutdown.load(std::memory_order_acquire);
             });
         }
     }
@@ -195,8 +230,102 @@ void ThreadPool::workerThread(size_t threadIndex) {
 LOG_DEBUG("Worker thread %zu exiting", threadIndex);
 }
 
+void ThreadPool::interactiveWorkerThread() {
+    LOG_DEBUG("Interactive worker thread started");
+    
+    while (!m_shutdown.load(std::memory_order_acquire)) {
+        Task task;
+        auto waitStart = std::chrono::steady_clock::now();
+        
+        if (tryGetInteractiveTask(task)) {
+            runInteractiveTask(task, waitStart);
+        } else {
+            std::unique_lock<std::mutex> lock(m_globalQueueMutex);
+            m_interactiveCondition.wait(lock, [this] {
+                return !m_interactiveQueue.empty() || m_shutdown.load(std::memory_order_acquire);
+            });
+        }
+    }
+    
+    LOG_DEBUG("Interactive worker thread exiting");
+}
+
+void ThreadPool::runTask(Task& task, std::chrono::steady_clock::time_point waitStart) {
+    auto waitEnd = std::chrono::steady_clock::now();
+    auto waitTime = std::chrono::duration_cast<std::chrono::microseconds>(waitEnd - waitStart).count();
+    
+    m_stats.activeThreads.fetch_add(1, std::memory_order_relaxed);
+    
+    auto execStart = std::chrono::steady_clock::now();
+    s_currentTaskId = task.getId();
+    task.execute();
+    s_currentTaskId = 0;
+    auto execEnd = std::chrono::steady_clock::now();
+    auto execTime = std::chrono::duration_cast<std::chrono::microseconds>(execEnd - execStart).count();
+    
+    m_stats.activeThreads.fetch_sub(1, std::memory_order_relaxed);
+    
+    updateStats(task, waitTime, execTime);
+    
+    // Clean up completed task from tracking map
+    {
+        std::unique_lock<std::mutex> lock(m_taskMapMutex);
+        m_taskCancellationFlags.erase(task.getId());
+    }
+}
+
+void ThreadPool::runInteractiveTask(Task& task, std::chrono::steady_clock::time_point waitStart) {
+    // Measured from submission: the interactive lane is about how long the player waits.
+    // Counted here, not when dequeued, so dropped tasks don't skew it
+    auto waitTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - task.getTimestamp()).count();
+    m_stats.interactiveCompleted.fetch_add(1, std::memory_order_relaxed);
+    m_stats.interactiveWaitTime.fetch_add(waitTime, std::memory_order_relaxed);
+    
+    runTask(task, waitStart);
+}
+
+bool ThreadPool::tryPopInteractiveTask(Task& task) {
+    std::unique_lock<std::mutex> lock(m_globalQueueMutex);
+    if (m_interactiveQueue.empty()) {
+        return false;
+    }
+    task = std::move(m_interactiveQueue.front());
+    m_interactiveQueue.pop_front();
+    return true;
+}
+
+bool ThreadPool::tryGetInteractiveTask(Task& task) {
+    // Cancelled tasks are discarded as they come up instead of being executed
+    while (tryPopInteractiveTask(task)) {
+        if (!task.isCancelled()) {
+            return true;
+        }
+        dropCancelledTask(task);
+    }
+    return false;
+}
+
 bool ThreadPool::tryGetTask(Task& task, size_t threadIndex) {
-    // First, try local queue
+    // Cancelled tasks are discarded as they come up instead of being executed
+    while (tryDequeueTask(task, threadIndex)) {
+        if (!task.isCancelled()) {
+            return true;
+        }
+        dropCancelledTask(task);
+    }
+    return false;
+}
+
+void ThreadPool::dropCancelledTask(const Task& task) {
+    m_stats.tasksDropped.fetch_add(1, std::memory_order_relaxed);
+    
+    std::unique_lock<std::mutex> lock(m_taskMapMutex);
+    m_taskCancellationFlags.erase(task.getId());
+}
+
+bool ThreadPool::tryDequeueTask(Task& task, size_t threadIndex) {
+    // Try local queue first (the interactive lane is checked by the caller)
     if (m_localQueues[threadIndex]->tryPop(task)) {
         return true;
     }
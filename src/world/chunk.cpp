@@ -8,25 +8,234 @@ namespace Zerith {
 
 Chunk::Chunk(glm::ivec3 chunkPosition) 
     : m_chunkPosition(std::move(chunkPosition)) {
-    // Initialize all blocks to air
-    std::fill(m_blocks.begin(), m_blocks.end(), Blocks::AIR);
-    std::fill(m_extendedBlocks.begin(), m_extendedBlocks.end(), Blocks::AIR);
+    // Initialize all blocks to air (uniform mode, nothing allocated until the first differing setBlock)
+    m_uniformBlock = Blocks::AIR;
     LOG_TRACE("Created chunk at position (%d, %d, %d)", m_chunkPosition.x, m_chunkPosition.y, m_chunkPosition.z);
 }
 
+std::unique_ptr<Chunk> Chunk::clone() const {
+    auto copy = std::make_unique<Chunk>(m_chunkPosition);
+    copy->m_palette = m_palette;
+    copy->m_paletteCounts = m_paletteCounts;
+    copy->m_packedIndices = m_packedIndices;
+    copy->m_bitsPerIndex = m_bitsPerIndex;
+    copy->m_uniformBlock = m_uniformBlock;
+    copy->m_contentFlags = m_contentFlags;
+    return copy;
+}
+
 BlockType Chunk::getBlock(int x, int y, int z) const {
     if (!isInBounds(x, y, z)) {
         return Blocks::AIR;
     }
-    return m_blocks[getIndex(x, y, z)];
+    if (isUniform()) {
+        return m_uniformBlock;
+    }
+    return m_palette[readPaletteIndex(getIndex(x, y, z))];
+}
+
+void Chunk::copyRow(int y, int z, int xBegin, int xEnd, BlockType* out) const {
+    if (isUniform()) {
+        std::fill(out, out + (xEnd - xBegin), m_uniformBlock);
+        return;
+    }
+    for (int x = xBegin; x < xEnd; ++x) {
+        *out++ = m_palette[readPaletteIndex(getIndex(x, y, z))];
+    }
 }
 
 void Chunk::setBlock(int x, int y, int z, BlockType type) {
-    if (isInBounds(x, y, z)) {
-        m_blocks[getIndex(x, y, z)] = type;
-        // Also update the extended block at the same position
-        setExtendedBlock(x, y, z, type);
+    if (!isInBounds(x, y, z)) {
+        return;
+    }
+    
+    if (isUniform()) {
+        if (type == m_uniformBlock) {
+            return; // No change, stay uniform
+        }
+        inflate();
+    }
+    
+    const int index = getIndex(x, y, z);
+    if (m_palette[readPaletteIndex(index)] == type) {
+        return;
+    }
+    
+    // Adding the entry may widen the indices, so read the old entry after
+    const uint32_t newEntry = findOrAddPaletteEntry(type);
+    const uint32_t oldEntry = readPaletteIndex(index);
+    writePaletteIndex(index, newEntry);
+    
+    const bool removedType = --m_paletteCounts[oldEntry] == 0;
+    const bool addedType = m_paletteCounts[newEntry]++ == 0;
+    if (removedType || addedType) {
+        updateContentFlags();
+    }
+}
+
+void Chunk::fill(BlockType type) {
+    m_uniformBlock = type;
+    m_bitsPerIndex = 0;
+    m_contentFlags = getContentFlags(type);
+    std::vector<BlockType>().swap(m_palette);
+    std::vector<uint16_t>().swap(m_paletteCounts);
+    std::vector<uint64_t>().swap(m_packedIndices);
+}
+
+void Chunk::optimizeStorage() {
+    if (isUniform()) {
+        return;
+    }
+    
+    compactPalette();
+    if (m_palette.size() == 1) {
+        fill(m_palette[0]);
+        return;
+    }
+    
+    // Narrowest index width that still addresses the whole palette
+    uint8_t bits = 1;
+    while ((size_t(1) << bits) < m_palette.size()) {
+        bits = bits == 8 ? 16 : bits * 2;
+    }
+    if (bits < m_bitsPerIndex) {
+        resizeIndices(bits);
+        m_packedIndices.shrink_to_fit();
+    }
+}
+
+int Chunk::getBlockCount(BlockType type) const {
+    if (isUniform()) {
+        return type == m_uniformBlock ? CHUNK_VOLUME : 0;
+    }
+    
+    // An edited-away type may still have an entry, with a count of 0
+    for (size_t i = 0; i < m_palette.size(); ++i) {
+        if (m_palette[i] == type && m_paletteCounts[i] > 0) {
+            return m_paletteCounts[i];
+        }
+    }
+    return 0;
+}
+
+uint8_t Chunk::getContentFlags(BlockType type) {
+    if (type == Blocks::AIR) {
+        return 0;
+    }
+    
+    const auto& props = BlockProperties::getCullingProperties(type);
+    if (props.isTransparent) {
+        return HAS_SOLID | HAS_TRANSPARENT | HAS_PARTIAL;
+    }
+    
+    const bool fullCube = props.canBeCulled && type != Blocks::OAK_STAIRS &&
+        std::all_of(props.faceCulling.begin(), props.faceCulling.end(),
+                    [](CullFace cull) { return cull == CullFace::FULL; });
+    return fullCube ? HAS_SOLID : HAS_SOLID | HAS_PARTIAL;
+}
+
+void Chunk::updateContentFlags() {
+    uint8_t flags = 0;
+    forEachBlockType([&flags](BlockType type, int) {
+        flags |= getContentFlags(type);
+    });
+    m_contentFlags = flags;
+}
+
+void Chunk::inflate() {
+    m_palette.assign(1, m_uniformBlock);
+    m_paletteCounts.assign(1, CHUNK_VOLUME);
+    m_bitsPerIndex = 1;
+    m_packedIndices.assign(CHUNK_VOLUME * m_bitsPerIndex / 64, 0);
+}
+
+size_t Chunk::getMemoryUsage() const {
+    return sizeof(Chunk) +
+           m_palette.capacity() * sizeof(BlockType) +
+           m_paletteCounts.capacity() * sizeof(uint16_t) +
+           m_packedIndices.capacity() * sizeof(uint64_t);
+}
+
+uint32_t Chunk::readPaletteIndex(int index) const {
+    // Bit widths are powers of two, so an entry never straddles two words
+    const uint32_t bitOffset = static_cast<uint32_t>(index) * m_bitsPerIndex;
+    const uint64_t mask = (uint64_t(1) << m_bitsPerIndex) - 1;
+    return static_cast<uint32_t>((m_packedIndices[bitOffset >> 6] >> (bitOffset & 63)) & mask);
+}
+
+void Chunk::writePaletteIndex(int index, uint32_t paletteIndex) {
+    const uint32_t bitOffset = static_cast<uint32_t>(index) * m_bitsPerIndex;
+    const uint64_t mask = (uint64_t(1) << m_bitsPerIndex) - 1;
+    uint64_t& word = m_packedIndices[bitOffset >> 6];
+    word = (word & ~(mask << (bitOffset & 63))) | ((uint64_t(paletteIndex) & mask) << (bitOffset & 63));
+}
+
+uint32_t Chunk::findOrAddPaletteEntry(BlockType type) {
+    // Palettes are small (usually < 16 entries), so a linear scan beats hashing
+    size_t unusedEntry = m_palette.size();
+    for (size_t i = 0; i < m_palette.size(); ++i) {
+        if (m_palette[i] == type) {
+            return static_cast<uint32_t>(i);
+        }
+        if (m_paletteCounts[i] == 0 && unusedEntry == m_palette.size()) {
+            unusedEntry = i;
+        }
+    }
+    
+    // Reuse an entry orphaned by earlier edits before growing the palette
+    if (unusedEntry < m_palette.size()) {
+        m_palette[unusedEntry] = type;
+        return static_cast<uint32_t>(unusedEntry);
+    }
+    
+    if (m_palette.size() >= (size_t(1) << m_bitsPerIndex)) {
+        resizeIndices(m_bitsPerIndex == 8 ? 16 : m_bitsPerIndex * 2);
     }
+    
+    m_palette.push_back(type);
+    m_paletteCounts.push_back(0);
+    return static_cast<uint32_t>(m_palette.size() - 1);
+}
+
+void Chunk::compactPalette() {
+    if (std::find(m_paletteCounts.begin(), m_paletteCounts.end(), 0) == m_paletteCounts.end()) {
+        return; // Every entry is still referenced
+    }
+    
+    // Build old -> new index remap, keeping entry order stable
+    std::vector<uint32_t> remap(m_palette.size(), 0);
+    std::vector<BlockType> compacted;
+    std::vector<uint16_t> compactedCounts;
+    compacted.reserve(m_palette.size());
+    compactedCounts.reserve(m_palette.size());
+    for (size_t i = 0; i < m_palette.size(); ++i) {
+        if (m_paletteCounts[i] > 0) {
+            remap[i] = static_cast<uint32_t>(compacted.size());
+            compacted.push_back(m_palette[i]);
+            compactedCounts.push_back(m_paletteCounts[i]);
+        }
+    }
+    
+    for (int i = 0; i < CHUNK_VOLUME; ++i) {
+        writePaletteIndex(i, remap[readPaletteIndex(i)]);
+    }
+    m_palette = std::move(compacted);
+    m_paletteCounts = std::move(compactedCounts);
+}
+
+void Chunk::resizeIndices(uint8_t newBits) {
+    std::vector<uint64_t> repacked(CHUNK_VOLUME * newBits / 64, 0);
+    for (int i = 0; i < CHUNK_VOLUME; ++i) {
+        const uint32_t bitOffset = static_cast<uint32_t>(i) * newBits;
+        repacked[bitOffset >> 6] |= uint64_t(readPaletteIndex(i)) << (bitOffset & 63);
+    }
+    
+    LOG_TRACE("Chunk (%d, %d, %d) repacked from %d to %d bits per block (%zu palette entries)",
+              m_chunkPosition.x, m_chunkPosition.y, m_chunkPosition.z,
+              m_bitsPerIndex, newBits, m_palette.size());
+    
+    m_packedIndices = std::move(repacked);
+    m_bitsPerIndex = newBits;
 }
 
 BlockType Chunk::getBlockWorld(const glm::vec3& worldPos) const {
@@ -188,33 +397,6 @@ constexpr int Chunk::getIndex(int x, int y, int z) const {
     return morton_x[x] | morton_y[y] | morton_z[z];
 }
 
-BlockType Chunk::getExtendedBlock(int x, int y, int z) const {
-    if (!isInExtendedBounds(x, y, z)) {
-        return Blocks::AIR;
-    }
-    return m_extendedBlocks[getExtendedIndex(x, y, z)];
-}
-
-void Chunk::setExtendedBlock(int x, int y, int z, BlockType type) {
-    if (isInExtendedBounds(x, y, z)) {
-        m_extendedBlocks[getExtendedIndex(x, y, z)] = type;
-    }
-}
-
-constexpr int Chunk::getExtendedIndex(int x, int y, int z) const {
-    // Convert -1..16 to 0..17 range
-    int ex = x + 1;
-    int ey = y + 1;
-    int ez = z + 1;
-    return ex + ey * EXTENDED_SIZE + ez * EXTENDED_SIZE * EXTENDED_SIZE;
-}
-
-constexpr bool Chunk::isInExtendedBounds(int x, int y, int z) const {
-    return x >= -1 && x <= 16 &&
-           y >= -1 && y <= 16 &&
-           z >= -1 && z <= 16;
-}
-
 constexpr bool Chunk::isInBounds(int x, int y, int z) const {
     return x >= 0 && x < CHUNK_SIZE &&
            y >= 0 && y < CHUNK_SIZE &&
@@ -0,0 +1,106 @@
+#include "chunk_cache.h"
+#include "epoch_reclaimer.h"
+
+namespace Zerith {
+
+ChunkCache::ChunkCache(size_t capacity)
+    : m_capacity(capacity) {
+}
+
+ChunkCache::~ChunkCache() {
+    clear();
+}
+
+void ChunkCache::put(const glm::ivec3& chunkPos, Entry entry) {
+    if (m_capacity == 0) {
+        retireEntry(entry);
+        return;
+    }
+
+    // A section is only cached once, but replace defensively
+    auto existing = m_index.find(chunkPos);
+    if (existing != m_index.end()) {
+        m_memoryBytes -= getEntryMemoryUsage(existing->second->second);
+        retireEntry(existing->second->second);
+        m_entries.erase(existing->second);
+        m_index.erase(existing);
+    }
+
+    while (m_index.size() >= m_capacity) {
+        evictOldest();
+    }
+
+    m_memoryBytes += getEntryMemoryUsage(entry);
+    m_entries.emplace_front(chunkPos, std::move(entry));
+    m_index[chunkPos] = m_entries.begin();
+}
+
+std::optional<ChunkCache::Entry> ChunkCache::take(const glm::ivec3& chunkPos) {
+    auto it = m_index.find(chunkPos);
+    if (it == m_index.end()) {
+        m_misses++;
+        return std::nullopt;
+    }
+
+    Entry entry = std::move(it->second->second);
+    m_memoryBytes -= getEntryMemoryUsage(entry);
+    m_entries.erase(it->second);
+    m_index.erase(it);
+    m_hits++;
+    return entry;
+}
+
+bool ChunkCache::dropMesh(const glm::ivec3& chunkPos) {
+    auto it = m_index.find(chunkPos);
+    if (it == m_index.end()) {
+        return false;
+    }
+
+    Entry& entry = it->second->second;
+    m_memoryBytes -= getEntryMemoryUsage(entry);
+    entry.mesh.reset();
+    m_memoryBytes += getEntryMemoryUsage(entry);
+    return true;
+}
+
+void ChunkCache::clear() {
+    for (auto& [chunkPos, entry] : m_entries) {
+        retireEntry(entry);
+    }
+    m_entries.clear();
+    m_index.clear();
+    m_memoryBytes = 0;
+}
+
+void ChunkCache::setCapacity(size_t capacity) {
+    m_capacity = capacity;
+    while (m_index.size() > m_capacity) {
+        evictOldest();
+    }
+}
+
+size_t ChunkCache::getEntryMemoryUsage(const Entry& entry) {
+    size_t bytes = 0;
+    if (entry.mesh) {
+        bytes += entry.mesh->faces.capacity() * sizeof(PackedFace);
+    }
+    if (entry.chunk) {
+        bytes += entry.chunk->getMemoryUsage();
+    }
+    return bytes;
+}
+
+void ChunkCache::evictOldest() {
+    auto& [chunkPos, entry] = m_entries.back();
+    m_memoryBytes -= getEntryMemoryUsage(entry);
+    retireEntry(entry);
+    m_index.erase(chunkPos);
+    m_entries.pop_back();
+    m_evictions++;
+}
+
+void ChunkCache::retireEntry(Entry& entry) {
+    EpochReclaimer::get().retire(entry.chunk.release());
+}
+
+} // namespace Zerith
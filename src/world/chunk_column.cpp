@@ -0,0 +1,154 @@
+#include "chunk_column.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace Zerith {
+
+uint32_t ChunkColumn::sectionRangeMask(int minChunkY, int maxChunkY) {
+    minChunkY = std::max(minChunkY, MIN_SECTION_Y);
+    maxChunkY = std::min(maxChunkY, MAX_SECTION_Y);
+    if (minChunkY > maxChunkY) {
+        return 0;
+    }
+
+    int count = maxChunkY - minChunkY + 1;
+    uint32_t mask = count >= 32 ? ~uint32_t(0) : (uint32_t(1) << count) - 1;
+    return mask << (minChunkY - MIN_SECTION_Y);
+}
+
+void ChunkLoadVolume::collectMissingSections(const glm::ivec3& center, const ChunkColumnMap& columns,
+                                             std::vector<glm::ivec3>& outMissing) const {
+    const uint32_t wanted = getSectionMask(center);
+    if (wanted == 0) {
+        return;
+    }
+
+    const int radiusSquared = horizontalRadius * horizontalRadius;
+    for (int dz = -horizontalRadius; dz <= horizontalRadius; ++dz) {
+        for (int dx = -horizontalRadius; dx <= horizontalRadius; ++dx) {
+            if (dx * dx + dz * dz > radiusSquared) {
+                continue;
+            }
+
+            glm::ivec2 columnPos(center.x + dx, center.z + dz);
+            uint32_t missing = wanted;
+            auto it = columns.find(columnPos);
+            if (it != columns.end()) {
+                missing &= ~(it->second.presentSections | it->second.loadingSections);
+            }
+
+            while (missing) {
+                int bit = std::countr_zero(missing);
+                missing &= missing - 1;
+                outMissing.emplace_back(columnPos.x, MIN_SECTION_Y + bit, columnPos.y);
+            }
+        }
+    }
+}
+
+void ChunkLoadVolume::collectLeavingSections(const glm::ivec3& center, const ChunkColumnMap& columns,
+                                             std::vector<glm::ivec3>& outLeaving) const {
+    const uint32_t wanted = getSectionMask(center);
+
+    for (const auto& [columnPos, column] : columns) {
+        uint32_t keep = containsColumn(center, columnPos) ? wanted : 0;
+        uint32_t leaving = column.presentSections & ~keep;
+
+        while (leaving) {
+            int bit = std::countr_zero(leaving);
+            leaving &= leaving - 1;
+            outLeaving.emplace_back(columnPos.x, MIN_SECTION_Y + bit, columnPos.y);
+        }
+    }
+}
+
+int ChunkLoadVolume::getRowHalfWidth(int dz) const {
+    int remaining = horizontalRadius * horizontalRadius - dz * dz;
+    if (remaining < 0) {
+        return -1;
+    }
+
+    // Integer square root, corrected for floating point rounding
+    int halfWidth = static_cast<int>(std::sqrt(static_cast<float>(remaining)));
+    while (halfWidth * halfWidth > remaining) --halfWidth;
+    while ((halfWidth + 1) * (halfWidth + 1) <= remaining) ++halfWidth;
+    return halfWidth;
+}
+
+void ChunkLoadVolume::collectDelta(const glm::ivec3& oldCenter, const glm::ivec3& newCenter,
+                                   const ChunkColumnMap& columns,
+                                   std::vector<glm::ivec3>& outEntering,
+                                   std::vector<glm::ivec3>& outLeaving) const {
+    const uint32_t oldMask = getSectionMask(oldCenter);
+    const uint32_t newMask = getSectionMask(newCenter);
+    const bool verticalChanged = oldMask != newMask;
+
+    auto emitSections = [](int x, int z, uint32_t sections, std::vector<glm::ivec3>& out) {
+        while (sections) {
+            int bit = std::countr_zero(sections);
+            sections &= sections - 1;
+            out.emplace_back(x, MIN_SECTION_Y + bit, z);
+        }
+    };
+
+    auto findColumn = [&columns](int x, int z) -> const ChunkColumn* {
+        auto it = columns.find(glm::ivec2(x, z));
+        return it != columns.end() ? &it->second : nullptr;
+    };
+
+    // Column entered the cylinder, or stayed in it while the vertical range moved
+    auto enterColumn = [&](int x, int z) {
+        uint32_t missing = newMask;
+        if (const ChunkColumn* column = findColumn(x, z)) {
+            missing &= ~(column->presentSections | column->loadingSections);
+        }
+        emitSections(x, z, missing, outEntering);
+    };
+
+    auto leaveColumn = [&](int x, int z, uint32_t keep) {
+        if (const ChunkColumn* column = findColumn(x, z)) {
+            emitSections(x, z, column->presentSections & ~keep, outLeaving);
+        }
+    };
+
+    const int zMin = std::min(oldCenter.z, newCenter.z) - horizontalRadius;
+    const int zMax = std::max(oldCenter.z, newCenter.z) + horizontalRadius;
+
+    for (int z = zMin; z <= zMax; ++z) {
+        const int oldHalf = getRowHalfWidth(z - oldCenter.z);
+        const int newHalf = getRowHalfWidth(z - newCenter.z);
+
+        // Row intervals [min, max]; empty when min > max
+        const int oldMin = oldHalf < 0 ? 1 : oldCenter.x - oldHalf;
+        const int oldMax = oldHalf < 0 ? 0 : oldCenter.x + oldHalf;
+        const int newMin = newHalf < 0 ? 1 : newCenter.x - newHalf;
+        const int newMax = newHalf < 0 ? 0 : newCenter.x + newHalf;
+
+        // Old minus new: at most two runs either side of the new interval
+        if (newMin > newMax) {
+            for (int x = oldMin; x <= oldMax; ++x) leaveColumn(x, z, 0);
+        } else {
+            for (int x = oldMin; x <= std::min(oldMax, newMin - 1); ++x) leaveColumn(x, z, 0);
+            for (int x = std::max(oldMin, newMax + 1); x <= oldMax; ++x) leaveColumn(x, z, 0);
+        }
+
+        // New minus old
+        if (oldMin > oldMax) {
+            for (int x = newMin; x <= newMax; ++x) enterColumn(x, z);
+        } else {
+            for (int x = newMin; x <= std::min(newMax, oldMin - 1); ++x) enterColumn(x, z);
+            for (int x = std::max(newMin, oldMax + 1); x <= newMax; ++x) enterColumn(x, z);
+        }
+
+        // Overlap only changes when the vertical range moved
+        if (verticalChanged) {
+            for (int x = std::max(oldMin, newMin); x <= std::min(oldMax, newMax); ++x) {
+                leaveColumn(x, z, newMask);
+                enterColumn(x, z);
+            }
+        }
+    }
+}
+
+} // namespace Zerith
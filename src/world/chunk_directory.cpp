@@ -0,0 +1,191 @@
+#include "chunk_directory.h"
+#include "epoch_reclaimer.h"
+#include "logger.h"
+#include <algorithm>
+#include <bit>
+
+namespace Zerith {
+
+ChunkDirectory::ChunkDirectory()
+    : m_table(new Table(MIN_CAPACITY)) {
+}
+
+ChunkDirectory::~ChunkDirectory() {
+    // Readers are gone by now, so live chunks can be freed directly
+    Table* table = m_table.load(std::memory_order_acquire);
+    for (size_t i = 0; i <= table->mask; ++i) {
+        delete table->slots[i].chunk.load(std::memory_order_relaxed);
+    }
+    delete table;
+}
+
+uint64_t ChunkDirectory::packKey(const glm::ivec3& chunkPos) {
+    return ((static_cast<uint64_t>(chunkPos.x) & 0xFFFFFFF) << 35) |
+           ((static_cast<uint64_t>(chunkPos.z) & 0xFFFFFFF) << 7) |
+           (static_cast<uint64_t>(chunkPos.y) & 0x7F);
+}
+
+bool ChunkDirectory::isSlotFor(const Slot& slot, const glm::ivec3& chunkPos) {
+    const Chunk* chunk = slot.chunk.load(std::memory_order_relaxed);
+    return chunk && chunk->getChunkPosition() == chunkPos;
+}
+
+size_t ChunkDirectory::hashKey(uint64_t key) {
+    // splitmix64 finalizer
+    key ^= key >> 30;
+    key *= 0xBF58476D1CE4E5B9ull;
+    key ^= key >> 27;
+    key *= 0x94D049BB133111EBull;
+    key ^= key >> 31;
+    return static_cast<size_t>(key);
+}
+
+Chunk* ChunkDirectory::find(const glm::ivec3& chunkPos) const {
+    const Table* table = m_table.load(std::memory_order_acquire);
+    const uint64_t key = packKey(chunkPos);
+
+    size_t index = hashKey(key) & table->mask;
+    for (size_t probe = 0; probe <= table->mask; ++probe) {
+        const Slot& slot = table->slots[index];
+        uint64_t slotKey = slot.key.load(std::memory_order_acquire);
+        if (slotKey == EMPTY_KEY) {
+            return nullptr;
+        }
+        if (slotKey == key) {
+            // Keys only hold 7 bits of y, and the slot may have been recycled
+            // between the two loads; the chunk's own position tells whether
+            // it is the one we want
+            Chunk* chunk = slot.chunk.load(std::memory_order_acquire);
+            if (chunk && chunk->getChunkPosition() == chunkPos) {
+                return chunk;
+            }
+        }
+        index = (index + 1) & table->mask;
+    }
+    return nullptr;
+}
+
+Chunk* ChunkDirectory::insert(std::unique_ptr<Chunk> chunk) {
+    if (!chunk) {
+        return nullptr;
+    }
+
+    // Keep live entries and tombstones under half the table so probes stay short
+    Table* table = m_table.load(std::memory_order_relaxed);
+    if ((m_occupied + 1) * 2 > table->mask + 1) {
+        rehash(std::max(MIN_CAPACITY, std::bit_ceil((m_size + 1) * 4)));
+        table = m_table.load(std::memory_order_relaxed);
+    }
+
+    const glm::ivec3 chunkPos = chunk->getChunkPosition();
+    const uint64_t key = packKey(chunkPos);
+    Chunk* published = chunk.release();
+
+    Slot* reusable = nullptr;
+    size_t index = hashKey(key) & table->mask;
+    for (size_t probe = 0; probe <= table->mask; ++probe) {
+        Slot& slot = table->slots[index];
+        uint64_t slotKey = slot.key.load(std::memory_order_relaxed);
+
+        if (slotKey == key && isSlotFor(slot, chunkPos)) {
+            // Replace in place; readers see either the old or the new chunk
+            Chunk* previous = slot.chunk.exchange(published, std::memory_order_acq_rel);
+            EpochReclaimer::get().retire(previous);
+            return published;
+        }
+        if (slotKey == TOMBSTONE_KEY && !reusable) {
+            reusable = &slot;
+        }
+        if (slotKey == EMPTY_KEY) {
+            break;
+        }
+        index = (index + 1) & table->mask;
+    }
+
+    Slot* target = reusable ? reusable : &table->slots[index];
+    if (!reusable) {
+        m_occupied++;
+    }
+
+    // Chunk first, then key: a reader that sees the key also sees the chunk
+    target->chunk.store(published, std::memory_order_release);
+    target->key.store(key, std::memory_order_release);
+    m_size++;
+    return published;
+}
+
+bool ChunkDirectory::erase(const glm::ivec3& chunkPos) {
+    std::unique_ptr<Chunk> chunk = extract(chunkPos);
+    if (!chunk) {
+        return false;
+    }
+    EpochReclaimer::get().retire(chunk.release());
+    return true;
+}
+
+std::unique_ptr<Chunk> ChunkDirectory::extract(const glm::ivec3& chunkPos) {
+    Table* table = m_table.load(std::memory_order_relaxed);
+    const uint64_t key = packKey(chunkPos);
+
+    size_t index = hashKey(key) & table->mask;
+    for (size_t probe = 0; probe <= table->mask; ++probe) {
+        Slot& slot = table->slots[index];
+        uint64_t slotKey = slot.key.load(std::memory_order_relaxed);
+        if (slotKey == EMPTY_KEY) {
+            return nullptr;
+        }
+        if (slotKey == key && isSlotFor(slot, chunkPos)) {
+            Chunk* chunk = slot.chunk.exchange(nullptr, std::memory_order_acq_rel);
+            slot.key.store(TOMBSTONE_KEY, std::memory_order_release);
+            m_size--;
+            return std::unique_ptr<Chunk>(chunk);
+        }
+        index = (index + 1) & table->mask;
+    }
+    return nullptr;
+}
+
+void ChunkDirectory::clear() {
+    Table* table = m_table.load(std::memory_order_relaxed);
+    for (size_t i = 0; i <= table->mask; ++i) {
+        Chunk* chunk = table->slots[i].chunk.load(std::memory_order_relaxed);
+        if (chunk) {
+            EpochReclaimer::get().retire(chunk);
+        }
+    }
+
+    // Readers may still be probing the old table
+    m_table.store(new Table(MIN_CAPACITY), std::memory_order_release);
+    EpochReclaimer::get().retire(table);
+    m_size = 0;
+    m_occupied = 0;
+}
+
+void ChunkDirectory::rehash(size_t capacity) {
+    Table* oldTable = m_table.load(std::memory_order_relaxed);
+    Table* newTable = new Table(capacity);
+
+    for (size_t i = 0; i <= oldTable->mask; ++i) {
+        Chunk* chunk = oldTable->slots[i].chunk.load(std::memory_order_relaxed);
+        if (!chunk) {
+            continue;
+        }
+
+        uint64_t key = packKey(chunk->getChunkPosition());
+        size_t index = hashKey(key) & newTable->mask;
+        while (newTable->slots[index].key.load(std::memory_order_relaxed) != EMPTY_KEY) {
+            index = (index + 1) & newTable->mask;
+        }
+        newTable->slots[index].chunk.store(chunk, std::memory_order_relaxed);
+        newTable->slots[index].key.store(key, std::memory_order_relaxed);
+    }
+
+    // Chunks move to the new table; only the old slot array is retired
+    m_table.store(newTable, std::memory_order_release);
+    EpochReclaimer::get().retire(oldTable);
+    m_occupied = m_size;
+
+    LOG_TRACE("ChunkDirectory: rehashed %zu chunks into %zu slots", m_size, capacity);
+}
+
+} // namespace Zerith
@@ -4,14 +4,50 @@
 #include "world_constants.h"
 #include "profiler.h"
 #include "extended_chunk_data.h"
+#include "block_properties.h"
+#include "epoch_reclaimer.h"
+#include "scratch_arena.h"
 #include <algorithm>
 #include <chrono>
 
 namespace Zerith {
 
+namespace {
+
+// Priority (1000 - effective distance squared) to thread pool bucket
+TaskPriority loadTaskPriority(int priority) {
+    if (priority > 900) return TaskPriority::Critical;
+    if (priority > 700) return TaskPriority::High;
+    if (priority > 500) return TaskPriority::Normal;
+    if (priority > 300) return TaskPriority::Low;
+    return TaskPriority::Idle;
+}
+
+TaskPriority meshTaskPriority(int priority) {
+    if (priority > 900) return TaskPriority::High;
+    if (priority > 700) return TaskPriority::Normal;
+    if (priority > 500) return TaskPriority::Low;
+    return TaskPriority::Idle;
+}
+
+// Stop tracking a finished task, unless the entry already belongs to a newer task
+// for the same chunk. Returns false if the result is from a task that was
+// cancelled or superseded after it started
+bool releaseTrackedTask(std::unordered_map<glm::ivec3, Task::TaskId>& tasks, std::mutex& mutex,
+                        const glm::ivec3& chunkPos, Task::TaskId taskId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = tasks.find(chunkPos);
+    if (it == tasks.end() || it->second != taskId) {
+        return false;
+    }
+    tasks.erase(it);
+    return true;
+}
+
+} // anonymous namespace
+
 ChunkManager::ChunkManager() {
     m_meshGenerator = std::make_unique<ChunkMeshGenerator>();
-    m_meshGenerator->setChunkManager(this); // Enable cross-chunk AO
     m_terrainGenerator = std::make_unique<TerrainGenerator>();
     
     // Initialize octree with generous world bounds
@@ -50,132 +86,316 @@ ChunkManager::~ChunkManager() {
     }
 }
 
-void ChunkManager::updateLoadedChunks(const glm::vec3& playerPosition) {
+void ChunkManager::updateLoadedChunks(const glm::vec3& playerPosition, const glm::vec3& cameraFront,
+                                      const glm::vec3& velocity) {
+    m_viewPosition = playerPosition;
+    m_viewFront = glm::length(cameraFront) > 0.0f ? glm::normalize(cameraFront) : glm::vec3(0.0f);
+    m_viewVelocity = velocity;
+    
     // Process any completed chunks first
     processCompletedChunks();
     
+    // Remesh the chunks edited since the last frame, once each
+    flushDirtyChunks();
+    
     // Get the chunk position the player is in
     glm::ivec3 playerChunkPos = worldToChunkPos(playerPosition);
-    
-    // Only update if player moved to a different chunk
-    if (playerChunkPos == m_lastPlayerChunkPos) {
-        return;
-    }
-    
-    m_lastPlayerChunkPos = playerChunkPos;
-    bool chunksChanged = false;
-    
-    // Find chunks to unload (outside render distance)
-    std::vector<glm::ivec3> chunksToUnload;
-    {
-        std::shared_lock<std::shared_mutex> lock(m_chunksMutex);
-        for (const auto& [chunkPos, chunk] : m_chunks) {
-            if (!isChunkInRange(chunkPos, playerChunkPos)) {
-                chunksToUnload.push_back(chunkPos);
-            }
+    const ChunkLoadVolume volume = getLoadVolume();
+    const ChunkLoadVolume unloadVolume = getUnloadVolume();
+    
+    // Recompute the load/unload work only when the player crossed into another
+    // chunk or the render distance changed
+    if (playerChunkPos != m_lastPlayerChunkPos || volume != m_lastLoadVolume) {
+        std::vector<glm::ivec3> entering;
+        std::vector<glm::ivec3> leaving;
+        
+        if (volume == m_lastLoadVolume) {
+            // Same volume, moved center: only the ring between the old and new
+            // cylinders is visited. Pending work from earlier crossings is kept
+            // and filtered when it is drained. Loads come from the load volume,
+            // unloads from the wider unload volume
+            std::vector<glm::ivec3> unused;
+            volume.collectDelta(m_lastPlayerChunkPos, playerChunkPos, m_columns, entering, unused);
+            unused.clear();
+            unloadVolume.collectDelta(m_lastPlayerChunkPos, playerChunkPos, m_columns, unused, leaving);
+        } else {
+            // First update or render distance change: rescan the known columns
+            // and the whole volume. This recomputes everything still pending
+            m_pendingLoads.clear();
+            m_pendingUnloads.clear();
+            unloadVolume.collectLeavingSections(playerChunkPos, m_columns, leaving);
+            volume.collectMissingSections(playerChunkPos, m_columns, entering);
+        }
+        
+        m_lastPlayerChunkPos = playerChunkPos;
+        m_lastLoadVolume = volume;
+        
+        // Work already handed to the thread pool for sections that just left
+        // range would only be thrown away
+        cancelOutOfRangeTasks();
+        
+        m_pendingUnloads.insert(m_pendingUnloads.end(), leaving.begin(), leaving.end());
+        m_pendingLoads.insert(m_pendingLoads.end(), entering.begin(), entering.end());
+        
+        const auto now = std::chrono::steady_clock::now();
+        for (const auto& chunkPos : entering) {
+            m_loadRequestTimes.emplace(chunkPos, now);
+        }
+        
+        // Sections generated ahead of the old mesh volume may be inside the new one
+        const std::vector<glm::ivec3> generated(m_generatedChunks.begin(), m_generatedChunks.end());
+        for (const auto& chunkPos : generated) {
+            scheduleFirstMesh(chunkPos);
         }
     }
     
-    // Unload distant chunks
-    for (const auto& chunkPos : chunksToUnload) {
-        unloadChunk(chunkPos);
-        chunksChanged = true;
+    // Re-score queued work when the player crossed a chunk or turned noticeably.
+    // This also orders new pending loads so the most urgent are submitted first
+    bool turned = glm::dot(m_viewFront, m_prioritizedFront) < REPRIORITIZE_TURN_COS;
+    if (playerChunkPos != m_prioritizedChunkPos || turned) {
+        reprioritizeQueuedTasks();
+        m_prioritizedChunkPos = playerChunkPos;
+        m_prioritizedFront = m_viewFront;
     }
     
-    // Load chunks within render distance asynchronously
-    for (int dx = -m_renderDistance; dx <= m_renderDistance; ++dx) {
-        for (int dy = -m_renderDistance; dy <= m_renderDistance; ++dy) {
-            for (int dz = -m_renderDistance; dz <= m_renderDistance; ++dz) {
-                glm::ivec3 chunkPos = playerChunkPos + glm::ivec3(dx, dy, dz);
-                
-                // Skip if outside world height limits
-                int worldY = chunkPos.y * Chunk::CHUNK_SIZE;
-                if (worldY < WORLD_MIN_Y || worldY > WORLD_MAX_Y) {
-                    continue;
-                }
-                
-                // Skip if outside render distance
-                if (!isChunkInRange(chunkPos, playerChunkPos)) {
-                    continue;
-                }
-                
-                // Check if already loaded or loading
-                {
-                    std::shared_lock<std::shared_mutex> lock(m_chunksMutex);
-                    if (m_chunks.find(chunkPos) != m_chunks.end()) {
-                        continue;
-                    }
-                }
-                
-                {
-                    std::lock_guard<std::mutex> lock(m_loadingMutex);
-                    if (m_loadingChunks.find(chunkPos) != m_loadingChunks.end()) {
-                        continue;
-                    }
-                }
-                
-                // Calculate priority based on distance to player
-                glm::ivec3 diff = chunkPos - playerChunkPos;
-                int distance = diff.x * diff.x + diff.y * diff.y + diff.z * diff.z;
-                int priority = 1000 - distance; // Closer chunks get higher priority
-                
-                loadChunkAsync(chunkPos, priority);
-            }
-        }
-    }
+    // Apply at most a frame's worth of the pending work so teleports and
+    // render distance changes are spread across several frames
+    bool chunksChanged = processPendingChunkUpdates();
     
     // Mark for rebuild if chunks changed
     if (chunksChanged) {
         m_needsRebuild = true;
-        rebuildAllFaceInstances();
+        rebuildIndirectCommands();
         // Only print chunk updates occasionally for performance
         static int updateCount = 0;
         if (++updateCount % 10 == 0) {
             std::shared_lock<std::shared_mutex> lock(m_chunksMutex);
-            LOG_DEBUG("Chunks loaded: %zu, Total faces: %zu", m_chunks.size(), m_allFaceInstances.size());
+            LOG_DEBUG("Chunks loaded: %zu, Total faces: %zu", m_chunks.size(), m_faceArena.getFaceCount());
         }
     }
 }
 
-void ChunkManager::rebuildAllFaceInstances() {
-    // Build new vector instead of clearing and rebuilding
-    std::vector<BlockbenchInstanceGenerator::FaceInstance> newFaceInstances;
+bool ChunkManager::processPendingChunkUpdates() {
+    PROFILE_FUNCTION();
     
-    // Lock once for the entire operation - more efficient
-    {
-        std::shared_lock<std::shared_mutex> lock(m_chunksMutex);
+    const ChunkLoadVolume volume = getLoadVolume();
+    const ChunkLoadVolume unloadVolume = getUnloadVolume();
+    bool chunksChanged = false;
+    
+    // Unload sections that are still out of range
+    int unloads = 0;
+    while (!m_pendingUnloads.empty() && unloads < MAX_UNLOADS_PER_FRAME) {
+        glm::ivec3 chunkPos = m_pendingUnloads.back();
+        m_pendingUnloads.pop_back();
         
-        // Calculate total size while we have the lock
-        size_t totalFaces = 0;
-        for (const auto& [chunkPos, faces] : m_chunkMeshes) {
-            totalFaces += faces.size();
+        if (unloadVolume.contains(m_lastPlayerChunkPos, chunkPos)) {
+            continue; // Came back into range before its turn
         }
         
-        // Reserve space for better performance
-        newFaceInstances.reserve(totalFaces);
+        unloadChunk(chunkPos);
+        chunksChanged = true;
+        unloads++;
+    }
+    
+    // Submit loads for sections that are still in range and not yet tracked
+    int loads = 0;
+    while (!m_pendingLoads.empty() && loads < MAX_LOADS_PER_FRAME) {
+        glm::ivec3 chunkPos = m_pendingLoads.back();
+        m_pendingLoads.pop_back();
         
-        // Collect all face instances from all chunks
-        for (const auto& [chunkPos, faces] : m_chunkMeshes) {
-            newFaceInstances.insert(newFaceInstances.end(), faces.begin(), faces.end());
+        if (!volume.contains(m_lastPlayerChunkPos, chunkPos)) {
+            m_loadRequestTimes.erase(chunkPos);
+            continue; // Left range before its turn
+        }
+        
+        auto columnIt = m_columns.find(glm::ivec2(chunkPos.x, chunkPos.z));
+        if (columnIt != m_columns.end()) {
+            uint32_t tracked = columnIt->second.presentSections | columnIt->second.loadingSections;
+            if (tracked & ChunkColumn::sectionBit(chunkPos.y)) {
+                continue; // Already loaded or in flight
+            }
+        }
+        
+        // Sections unloaded recently come back without generation or meshing
+        if (restoreCachedChunk(chunkPos)) {
+            chunksChanged = true;
+        } else {
+            loadChunkAsync(chunkPos, computeChunkPriority(chunkPos));
+        }
+        loads++;
+    }
+    
+    return chunksChanged;
+}
+
+int ChunkManager::computeChunkPriority(const glm::ivec3& chunkPos) const {
+    const float chunkSize = static_cast<float>(Chunk::CHUNK_SIZE);
+    const glm::vec3 chunkCenter = (glm::vec3(chunkPos) + glm::vec3(0.5f)) * chunkSize;
+    
+    // Score against where the player will shortly be, so fast movement loads ahead
+    const glm::vec3 predicted = m_viewPosition + m_viewVelocity * PRIORITY_LOOKAHEAD_SECONDS;
+    const glm::vec3 toChunk = (chunkCenter - predicted) / chunkSize;
+    const float distance = glm::length(toChunk);
+    
+    // Chunks outside the view cone count as further away; the immediate
+    // surroundings are always needed (collision, turning around)
+    float viewWeight = 1.0f;
+    if (distance > 1.5f && glm::length(m_viewFront) > 0.0f) {
+        float facing = glm::dot(toChunk / distance, m_viewFront);
+        if (facing < VIEW_CONE_COS) {
+            viewWeight += (VIEW_CONE_COS - facing) * OUT_OF_VIEW_WEIGHT;
+        }
+    }
+    
+    const float effective = distance * viewWeight;
+    return 1000 - static_cast<int>(effective * effective);
+}
+
+bool ChunkManager::isChunkInView(const glm::ivec3& chunkPos) const {
+    const glm::vec3 chunkCenter = (glm::vec3(chunkPos) + glm::vec3(0.5f)) * static_cast<float>(Chunk::CHUNK_SIZE);
+    const glm::vec3 toChunk = chunkCenter - m_viewPosition;
+    const float distance = glm::length(toChunk);
+    if (distance < 1.5f * Chunk::CHUNK_SIZE || glm::length(m_viewFront) == 0.0f) {
+        return true;
+    }
+    return glm::dot(toChunk / distance, m_viewFront) >= VIEW_CONE_COS;
+}
+
+void ChunkManager::reprioritizeQueuedTasks() {
+    PROFILE_FUNCTION();
+    
+    // Task id -> (chunk, is mesh task) for everything still tracked
+    std::unordered_map<Task::TaskId, std::pair<glm::ivec3, bool>> tracked;
+    {
+        std::lock_guard<std::mutex> lock(m_loadingMutex);
+        for (const auto& [chunkPos, taskId] : m_loadingChunks) {
+            tracked[taskId] = {chunkPos, false};
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_meshingMutex);
+        for (const auto& [chunkPos, taskId] : m_meshingChunks) {
+            tracked[taskId] = {chunkPos, true};
+        }
+    }
+    
+    if (!tracked.empty()) {
+        g_threadPool->reprioritizeTasks([this, &tracked](Task& task) {
+            auto it = tracked.find(task.getId());
+            if (it == tracked.end()) {
+                return;
+            }
+            const auto& [chunkPos, isMesh] = it->second;
+            int priority = computeChunkPriority(chunkPos);
+            task.setPriority(isMesh ? meshTaskPriority(priority) : loadTaskPriority(priority));
+            task.setScore(priority);
+        });
+    }
+    
+    // Most urgent pending loads at the back so they are submitted first
+    std::vector<std::pair<int, glm::ivec3>> scored;
+    scored.reserve(m_pendingLoads.size());
+    for (const auto& chunkPos : m_pendingLoads) {
+        scored.emplace_back(computeChunkPriority(chunkPos), chunkPos);
+    }
+    std::sort(scored.begin(), scored.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    for (size_t i = 0; i < scored.size(); ++i) {
+        m_pendingLoads[i] = scored[i].second;
+    }
+    
+    m_reprioritizations++;
+}
+
+void ChunkManager::cancelOutOfRangeTasks() {
+    PROFILE_FUNCTION();
+    
+    // Sections inside the hysteresis margin are kept, so is their in-flight work
+    const ChunkLoadVolume volume = getUnloadVolume();
+    std::vector<glm::ivec3> cancelledLoads;
+    std::vector<glm::ivec3> cancelledMeshes;
+    
+    {
+        std::lock_guard<std::mutex> lock(m_loadingMutex);
+        for (auto it = m_loadingChunks.begin(); it != m_loadingChunks.end();) {
+            if (volume.contains(m_lastPlayerChunkPos, it->first)) {
+                ++it;
+                continue;
+            }
+            g_threadPool->cancelTask(it->second);
+            cancelledLoads.push_back(it->first);
+            it = m_loadingChunks.erase(it);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_meshingMutex);
+        for (auto it = m_meshingChunks.begin(); it != m_meshingChunks.end();) {
+            if (volume.contains(m_lastPlayerChunkPos, it->first)) {
+                ++it;
+                continue;
+            }
+            g_threadPool->cancelTask(it->second);
+            cancelledMeshes.push_back(it->first);
+            it = m_meshingChunks.erase(it);
+        }
+    }
+    
+    // Untracked sections can be requested again if they come back into range
+    for (const auto& chunkPos : cancelledLoads) {
+        setSectionLoading(chunkPos, false);
+        m_loadRequestTimes.erase(chunkPos);
+    }
+    for (const auto& chunkPos : cancelledMeshes) {
+        // A remesh merged while the task was in flight would requeue it on the next flush
+        m_cancelledMeshes.insert(chunkPos);
+        m_dirtyChunks.erase(chunkPos);
+    }
+    m_taskStats.cancelledLoads += cancelledLoads.size();
+    m_taskStats.cancelledMeshes += cancelledMeshes.size();
+    
+    // Chunks that came back before their unload still need the mesh they lost
+    for (auto it = m_cancelledMeshes.begin(); it != m_cancelledMeshes.end();) {
+        if (!volume.contains(m_lastPlayerChunkPos, *it)) {
+            ++it;
+            continue;
         }
+        if (m_chunks.contains(*it)) {
+            queueMeshGeneration(*it, computeChunkPriority(*it));
+        }
+        it = m_cancelledMeshes.erase(it);
+    }
+    
+    if (!cancelledLoads.empty() || !cancelledMeshes.empty()) {
+        LOG_TRACE("Cancelled %zu load and %zu mesh tasks out of range", cancelledLoads.size(), cancelledMeshes.size());
+    }
+}
+
+void ChunkManager::recordTimeToVisible(const glm::ivec3& chunkPos) {
+    auto it = m_loadRequestTimes.find(chunkPos);
+    if (it == m_loadRequestTimes.end()) {
+        return; // Remesh of a chunk that was already visible
     }
     
-    // Move the new vector to replace the old one (avoids unnecessary deallocations)
-    m_allFaceInstances = std::move(newFaceInstances);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - it->second).count();
+    m_loadRequestTimes.erase(it);
     
-    // Rebuild indirect commands for proper GPU indirect drawing
-    rebuildIndirectCommands();
+    // Running averages
+    if (isChunkInView(chunkPos)) {
+        m_latencyStats.inViewSamples++;
+        m_latencyStats.avgInViewMs += (ms - m_latencyStats.avgInViewMs) / m_latencyStats.inViewSamples;
+    } else {
+        m_latencyStats.outOfViewSamples++;
+        m_latencyStats.avgOutOfViewMs += (ms - m_latencyStats.avgOutOfViewMs) / m_latencyStats.outOfViewSamples;
+    }
 }
 
 void ChunkManager::rebuildIndirectCommands() {
     m_indirectDrawManager.clear();
     
     // Build chunk data for all chunks
-    uint32_t currentFaceIndex = 0;
     uint32_t chunkCount = 0;
     
-    for (const auto& [chunkPos, faces] : m_chunkMeshes) {
-        if (faces.empty()) continue;
+    for (const auto& [chunkPos, slab] : m_faceArena.getSlabs()) {
+        if (slab.count == 0) continue;
         
         // Calculate chunk bounds in world space
         glm::vec3 chunkWorldPos = glm::vec3(chunkPos) * float(Chunk::CHUNK_SIZE);
@@ -185,16 +405,22 @@ void ChunkManager::rebuildIndirectCommands() {
             chunkWorldPos.y + Chunk::CHUNK_SIZE,
             chunkWorldPos.z + Chunk::CHUNK_SIZE
         };
+        int32_t origin[3] = {
+            chunkPos.x * Chunk::CHUNK_SIZE,
+            chunkPos.y * Chunk::CHUNK_SIZE,
+            chunkPos.z * Chunk::CHUNK_SIZE
+        };
         
-        // Add chunk data (but not individual draw commands)
+        // Add chunk data (but not individual draw commands); faces are read from the chunk's
+        // slab, where each render layer is its own range
         m_indirectDrawManager.addChunkData(
-            static_cast<uint32_t>(faces.size()),
+            slab.mesh->layerCounts.data(),
             minBounds,
             maxBounds,
-            currentFaceIndex
+            slab.offset,
+            origin
         );
         
-        currentFaceIndex += static_cast<uint32_t>(faces.size());
         chunkCount++;
     }
     
@@ -205,9 +431,8 @@ void ChunkManager::rebuildIndirectCommands() {
 }
 
 Chunk* ChunkManager::getChunk(const glm::ivec3& chunkPos) {
-    std::shared_lock<std::shared_mutex> lock(m_chunksMutex);
-    auto it = m_chunks.find(chunkPos);
-    return (it != m_chunks.end()) ? it->second.get() : nullptr;
+    EpochReclaimer::Guard guard;
+    return m_chunks.find(chunkPos);
 }
 
 BlockType ChunkManager::getBlock(const glm::vec3& worldPos) const {
@@ -234,29 +459,88 @@ BlockType ChunkManager::getBlock(const glm::vec3& worldPos) const {
         return Blocks::AIR;
     }
     
-    std::shared_lock<std::shared_mutex> lock(m_chunksMutex);
-    auto it = m_chunks.find(chunkPos);
-    if (it == m_chunks.end()) {
+    // Lock-free lookup: the pinned epoch keeps the chunk alive even if the
+    // main thread unloads or replaces it meanwhile
+    EpochReclaimer::Guard guard;
+    const Chunk* chunk = m_chunks.find(chunkPos);
+    if (!chunk) {
         return Blocks::AIR;
     }
     
     // Direct block access instead of going through getBlockWorld
-    return it->second->getBlock(adjustedLocalX, adjustedLocalY, adjustedLocalZ);
+    return chunk->getBlock(adjustedLocalX, adjustedLocalY, adjustedLocalZ);
+}
+
+bool ChunkManager::copyRegion(const glm::ivec3& min, const glm::ivec3& max, std::span<BlockType> out) const {
+    if (max.x < min.x || max.y < min.y || max.z < min.z) {
+        return true; // Empty region
+    }
+    
+    const glm::ivec3 size = max - min + glm::ivec3(1);
+    if (out.size() < static_cast<size_t>(size.x) * size.y * size.z) {
+        LOG_ERROR("copyRegion: buffer holds %zu blocks, region needs %d", out.size(), size.x * size.y * size.z);
+        return false;
+    }
+    
+    BlockRegionView view;
+    view.data = out.data();
+    view.rowStride = static_cast<size_t>(size.x);
+    view.sliceStride = static_cast<size_t>(size.x) * size.y;
+    copyRegion(min, max, view);
+    return true;
+}
+
+void ChunkManager::copyRegion(const glm::ivec3& min, const glm::ivec3& max, const BlockRegionView& out) const {
+    if (max.x < min.x || max.y < min.y || max.z < min.z) {
+        return;
+    }
+    
+    // Arithmetic shift floors negative coordinates
+    const glm::ivec3 minChunk(min.x >> 4, min.y >> 4, min.z >> 4);
+    const glm::ivec3 maxChunk(max.x >> 4, max.y >> 4, max.z >> 4);
+    
+    EpochReclaimer::Guard guard;
+    for (int cz = minChunk.z; cz <= maxChunk.z; ++cz) {
+        for (int cy = minChunk.y; cy <= maxChunk.y; ++cy) {
+            for (int cx = minChunk.x; cx <= maxChunk.x; ++cx) {
+                const glm::ivec3 chunkOrigin = glm::ivec3(cx, cy, cz) * Chunk::CHUNK_SIZE;
+                const Chunk* chunk = m_chunks.find(glm::ivec3(cx, cy, cz));
+                
+                // Part of the region inside this chunk, in local coordinates
+                const glm::ivec3 lo = glm::max(min, chunkOrigin) - chunkOrigin;
+                const glm::ivec3 hi = glm::min(max, chunkOrigin + glm::ivec3(Chunk::CHUNK_SIZE - 1)) - chunkOrigin;
+                const int rowLength = hi.x - lo.x + 1;
+                
+                for (int z = lo.z; z <= hi.z; ++z) {
+                    for (int y = lo.y; y <= hi.y; ++y) {
+                        BlockType* row = out.data
+                            + static_cast<size_t>(chunkOrigin.x + lo.x - min.x)
+                            + static_cast<size_t>(chunkOrigin.y + y - min.y) * out.rowStride
+                            + static_cast<size_t>(chunkOrigin.z + z - min.z) * out.sliceStride;
+                        
+                        if (chunk) {
+                            chunk->copyRow(y, z, lo.x, hi.x + 1, row);
+                        } else {
+                            std::fill_n(row, rowLength, Blocks::AIR);
+                        }
+                    }
+                }
+            }
+        }
+    }
 }
 
 void ChunkManager::setBlock(const glm::vec3& worldPos, BlockType type) {
     glm::ivec3 chunkPos = worldToChunkPos(worldPos);
     
-    // First check if chunk is loaded (read lock)
-    Chunk* chunk = nullptr;
-    {
-        std::shared_lock<std::shared_mutex> lock(m_chunksMutex);
-        auto it = m_chunks.find(chunkPos);
-        if (it != m_chunks.end()) {
-            chunk = it->second.get();
-        }
+    // Nothing exists above or below the world
+    if (!ChunkColumn::isValidSection(chunkPos.y)) {
+        return;
     }
     
+    // First check if chunk is loaded (the main thread is the only writer)
+    Chunk* chunk = m_chunks.find(chunkPos);
+    
     // If chunk doesn't exist, load it synchronously
     if (!chunk) {
         LOG_DEBUG("Chunk at (%d, %d, %d) not loaded for setBlock, loading synchronously", 
@@ -264,23 +548,29 @@ void ChunkManager::setBlock(const glm::vec3& worldPos, BlockType type) {
         loadChunk(chunkPos);
         
         // Try again after loading
-        std::shared_lock<std::shared_mutex> lock(m_chunksMutex);
-        auto it = m_chunks.find(chunkPos);
-        if (it == m_chunks.end()) {
+        chunk = m_chunks.find(chunkPos);
+        if (!chunk) {
             LOG_ERROR("Failed to load chunk at (%d, %d, %d) for setBlock", 
                      chunkPos.x, chunkPos.y, chunkPos.z);
             return;
         }
-        chunk = it->second.get();
     }
     
-    // Use per-chunk locking for the actual block modification
-    auto chunkMutex = getChunkMutex(chunkPos);
-    glm::ivec3 localPos;
+    // Fill tools and explosions rewrite blocks that already hold the type;
+    // those cost neither a chunk copy nor a remesh
+    glm::ivec3 localPos = chunk->worldToLocal(worldPos);
+    if (chunk->getBlock(localPos.x, localPos.y, localPos.z) == type) {
+        return;
+    }
+    
+    // Published chunks are read without locks, so edits go to a copy that
+    // replaces the original; the old chunk is freed once no reader holds it
+    auto edited = chunk->clone();
+    edited->setBlock(localPos.x, localPos.y, localPos.z, type);
     {
-        std::lock_guard<std::mutex> chunkLock(*chunkMutex);
-        localPos = chunk->worldToLocal(worldPos);
-        chunk->setBlock(localPos.x, localPos.y, localPos.z, type);
+        std::unique_lock<std::shared_mutex> lock(m_chunksMutex);
+        m_chunkOctree->removeChunk(chunk);
+        m_chunkOctree->addChunk(m_chunks.insert(std::move(edited)));
         LOG_DEBUG("Block %s at world pos (%.1f, %.1f, %.1f) chunk pos (%d, %d, %d) local pos (%d, %d, %d)", 
                  type == Blocks::AIR ? "destroyed" : "placed",
                  worldPos.x, worldPos.y, worldPos.z,
@@ -288,71 +578,47 @@ void ChunkManager::setBlock(const glm::vec3& worldPos, BlockType type) {
                  localPos.x, localPos.y, localPos.z);
     }
     
-    // Update extended blocks in neighboring chunks if block is on edge
-    {
-        std::shared_lock<std::shared_mutex> lock(m_chunksMutex);
-        
-        if (localPos.x == 0) {
-            auto it = m_chunks.find(chunkPos + glm::ivec3(-1, 0, 0));
-            if (it != m_chunks.end()) {
-                it->second->setExtendedBlock(Chunk::CHUNK_SIZE, localPos.y, localPos.z, type);
-            }
-        }
-        if (localPos.x == Chunk::CHUNK_SIZE - 1) {
-            auto it = m_chunks.find(chunkPos + glm::ivec3(1, 0, 0));
-            if (it != m_chunks.end()) {
-                it->second->setExtendedBlock(-1, localPos.y, localPos.z, type);
-            }
-        }
-        if (localPos.y == 0) {
-            auto it = m_chunks.find(chunkPos + glm::ivec3(0, -1, 0));
-            if (it != m_chunks.end()) {
-                it->second->setExtendedBlock(localPos.x, Chunk::CHUNK_SIZE, localPos.z, type);
-            }
-        }
-        if (localPos.y == Chunk::CHUNK_SIZE - 1) {
-            auto it = m_chunks.find(chunkPos + glm::ivec3(0, 1, 0));
-            if (it != m_chunks.end()) {
-                it->second->setExtendedBlock(localPos.x, -1, localPos.z, type);
-            }
-        }
-        if (localPos.z == 0) {
-            auto it = m_chunks.find(chunkPos + glm::ivec3(0, 0, -1));
-            if (it != m_chunks.end()) {
-                it->second->setExtendedBlock(localPos.x, localPos.y, Chunk::CHUNK_SIZE, type);
-            }
-        }
-        if (localPos.z == Chunk::CHUNK_SIZE - 1) {
-            auto it = m_chunks.find(chunkPos + glm::ivec3(0, 0, 1));
-            if (it != m_chunks.end()) {
-                it->second->setExtendedBlock(localPos.x, localPos.y, -1, type);
+    // Regenerate the slices of this chunk's mesh around the block
+    const auto editTime = std::chrono::steady_clock::now();
+    regenerateChunkMesh(chunkPos, ChunkMeshGenerator::getSlicesAround(localPos), editTime);
+    
+    // Neighbors read their border from this chunk when remeshed, so edge edits
+    // only need the meshes whose padded snapshot holds the block regenerated:
+    // up to 7 of them for a corner block (edges and corners feed AO)
+    auto edgeOffset = [](int local) {
+        return local == 0 ? -1 : (local == Chunk::CHUNK_SIZE - 1 ? 1 : 0);
+    };
+    const glm::ivec3 edge(edgeOffset(localPos.x), edgeOffset(localPos.y), edgeOffset(localPos.z));
+    for (int dz = std::min(edge.z, 0); dz <= std::max(edge.z, 0); ++dz) {
+        for (int dy = std::min(edge.y, 0); dy <= std::max(edge.y, 0); ++dy) {
+            for (int dx = std::min(edge.x, 0); dx <= std::max(edge.x, 0); ++dx) {
+                const glm::ivec3 offset(dx, dy, dz);
+                if (offset != glm::ivec3(0)) {
+                    regenerateChunkMesh(chunkPos + offset,
+                                        ChunkMeshGenerator::getSlicesAround(localPos - offset * Chunk::CHUNK_SIZE),
+                                        editTime);
+                }
             }
         }
     }
-    
-    // Regenerate mesh for this chunk
-    regenerateChunkMesh(chunkPos);
-    
-    // Also regenerate neighboring chunks if block is on edge
-    if (localPos.x == 0) regenerateChunkMesh(chunkPos + glm::ivec3(-1, 0, 0));
-    if (localPos.x == Chunk::CHUNK_SIZE - 1) regenerateChunkMesh(chunkPos + glm::ivec3(1, 0, 0));
-    if (localPos.y == 0) regenerateChunkMesh(chunkPos + glm::ivec3(0, -1, 0));
-    if (localPos.y == Chunk::CHUNK_SIZE - 1) regenerateChunkMesh(chunkPos + glm::ivec3(0, 1, 0));
-    if (localPos.z == 0) regenerateChunkMesh(chunkPos + glm::ivec3(0, 0, -1));
-    if (localPos.z == Chunk::CHUNK_SIZE - 1) regenerateChunkMesh(chunkPos + glm::ivec3(0, 0, 1));
-    
-    // Mark for rebuild and rebuild the combined face instances
-    m_needsRebuild = true;
-    rebuildAllFaceInstances();
 }
 
 size_t ChunkManager::getTotalFaceCount() const {
     std::shared_lock<std::shared_mutex> lock(m_chunksMutex);
-    size_t total = 0;
-    for (const auto& [chunkPos, faces] : m_chunkMeshes) {
-        total += faces.size();
-    }
-    return total;
+    return m_faceArena.getFaceCount();
+}
+
+ChunkStorageStats ChunkManager::getChunkStorageStats() const {
+    std::shared_lock<std::shared_mutex> lock(m_chunksMutex);
+    ChunkStorageStats stats;
+    m_chunks.forEach([&stats](const glm::ivec3&, const Chunk& chunk) {
+        stats.memoryBytes += chunk.getMemoryUsage();
+        if (chunk.isUniform()) {
+            stats.uniformChunks++;
+        }
+    });
+    stats.skippedMeshes = m_skippedUniformMeshes;
+    return stats;
 }
 
 glm::ivec3 ChunkManager::worldToChunkPos(const glm::vec3& worldPos) const {
@@ -365,72 +631,51 @@ glm::ivec3 ChunkManager::worldToChunkPos(const glm::vec3& worldPos) const {
 
 void ChunkManager::loadChunk(const glm::ivec3& chunkPos) {
     LOG_INFO("CHUNK MANAGER: loadChunk called for (%d, %d, %d)", chunkPos.x, chunkPos.y, chunkPos.z);
+    
+    // Sections outside the world are never loaded
+    if (!ChunkColumn::isValidSection(chunkPos.y)) {
+        return;
+    }
+    
+    // A recently unloaded section keeps its edits, and a cached copy left behind
+    // would replace the regenerated chunk when the section is next restored
+    if (restoreCachedChunk(chunkPos)) {
+        return;
+    }
+    
     // Create new chunk
     auto chunk = std::make_unique<Chunk>(chunkPos);
     
     // Generate terrain
     generateTerrain(*chunk);
     
-    // Get neighboring chunks for proper face culling
-    const Chunk* neighborXMinus = nullptr;
-    const Chunk* neighborXPlus = nullptr;
-    const Chunk* neighborYMinus = nullptr;
-    const Chunk* neighborYPlus = nullptr;
-    const Chunk* neighborZMinus = nullptr;
-    const Chunk* neighborZPlus = nullptr;
-    
-    auto neighborIt = m_chunks.find(chunkPos + glm::ivec3(-1, 0, 0));
-    if (neighborIt != m_chunks.end()) neighborXMinus = neighborIt->second.get();
-    
-    neighborIt = m_chunks.find(chunkPos + glm::ivec3(1, 0, 0));
-    if (neighborIt != m_chunks.end()) neighborXPlus = neighborIt->second.get();
-    
-    neighborIt = m_chunks.find(chunkPos + glm::ivec3(0, -1, 0));
-    if (neighborIt != m_chunks.end()) neighborYMinus = neighborIt->second.get();
-    
-    neighborIt = m_chunks.find(chunkPos + glm::ivec3(0, 1, 0));
-    if (neighborIt != m_chunks.end()) neighborYPlus = neighborIt->second.get();
-    
-    neighborIt = m_chunks.find(chunkPos + glm::ivec3(0, 0, -1));
-    if (neighborIt != m_chunks.end()) neighborZMinus = neighborIt->second.get();
-    
-    neighborIt = m_chunks.find(chunkPos + glm::ivec3(0, 0, 1));
-    if (neighborIt != m_chunks.end()) neighborZPlus = neighborIt->second.get();
-    
-    // Generate layered mesh with neighbor awareness
-    LOG_INFO("CHUNK MANAGER: Using generateLayeredChunkMeshWithNeighbors for chunk at (%d,%d,%d)", 
-             chunkPos.x, chunkPos.y, chunkPos.z);
-    auto layeredMesh = m_meshGenerator->generateLayeredChunkMeshWithNeighbors(*chunk,
-                                                                               neighborXMinus, neighborXPlus,
-                                                                               neighborYMinus, neighborYPlus,
-                                                                               neighborZMinus, neighborZPlus);
-    
-    // Flatten the layered mesh into a single vector for compatibility
-    // Order: opaque first, then cutout, then translucent (for proper rendering order)
-    std::vector<BlockbenchInstanceGenerator::FaceInstance> faces;
-    const auto& opaque = layeredMesh.getOpaqueFaces();
-    const auto& cutout = layeredMesh.getCutoutFaces();
-    const auto& translucent = layeredMesh.getTranslucentFaces();
-    
-    LOG_INFO("CHUNK (%d,%d,%d): Generated %zu opaque, %zu cutout, %zu translucent faces", 
-             chunkPos.x, chunkPos.y, chunkPos.z, opaque.size(), cutout.size(), translucent.size());
-    
-    faces.reserve(opaque.size() + cutout.size() + translucent.size());
-    faces.insert(faces.end(), opaque.begin(), opaque.end());
-    faces.insert(faces.end(), cutout.begin(), cutout.end());
-    faces.insert(faces.end(), translucent.begin(), translucent.end());
-    
-    m_chunkMeshes[chunkPos] = std::move(faces);
+    {
+        std::unique_lock<std::shared_mutex> lock(m_chunksMutex);
+        Chunk* stored = m_chunks.insert(std::move(chunk));
+        
+        // Add to octree for spatial queries
+        m_chunkOctree->addChunk(stored);
+        setSectionPresent(chunkPos, true);
+    }
     
-    // Store chunk
-    m_chunks[chunkPos] = std::move(chunk);
+    // Meshed through the same gate and mesher as streamed sections
+    m_chunkStates[chunkPos] = ChunkState::Generated;
+    m_generatedChunks.insert(chunkPos);
     
-    // Add to octree for spatial queries
-    m_chunkOctree->addChunk(m_chunks[chunkPos].get());
+    std::vector<glm::ivec3> neighborsToRemesh;
+    onSectionAdded(chunkPos, neighborsToRemesh);
+    for (const auto& neighborPos : neighborsToRemesh) {
+        regenerateChunkMesh(neighborPos);
+    }
 }
 
 void ChunkManager::unloadChunk(const glm::ivec3& chunkPos) {
     LOG_TRACE("Unloading chunk at (%d, %d, %d)", chunkPos.x, chunkPos.y, chunkPos.z);
+    m_loadRequestTimes.erase(chunkPos);
+    m_chunkStates.erase(chunkPos);
+    m_generatedChunks.erase(chunkPos);
+    m_dirtyChunks.erase(chunkPos);
+    m_cancelledMeshes.erase(chunkPos);
     
     // Cancel any pending async tasks for this chunk first
     {
@@ -441,82 +686,188 @@ void ChunkManager::unloadChunk(const glm::ivec3& chunkPos) {
             m_loadingChunks.erase(loadIt);
         }
     }
+    setSectionLoading(chunkPos, false);
+    setSectionPresent(chunkPos, false);
     
+    // A mesh still in flight means the current one is stale
+    bool meshStale = m_cancelledMeshes.erase(chunkPos) > 0;
     {
         std::lock_guard<std::mutex> meshLock(m_meshingMutex);
         auto meshIt = m_meshingChunks.find(chunkPos);
         if (meshIt != m_meshingChunks.end()) {
             g_threadPool->cancelTask(meshIt->second);
             m_meshingChunks.erase(meshIt);
+            meshStale = true;
         }
     }
     
     // Now safely remove the chunk data
     std::unique_lock<std::shared_mutex> lock(m_chunksMutex);
     
-    // Remove from octree before erasing from the map
-    auto it = m_chunks.find(chunkPos);
-    if (it != m_chunks.end()) {
-        m_chunkOctree->removeChunk(it->second.get());
-        m_chunks.erase(it);
+    ChunkCache::Entry entry;
+    
+    // Remove from octree before unlinking from the map
+    if (Chunk* chunk = m_chunks.find(chunkPos)) {
+        m_chunkOctree->removeChunk(chunk);
+        entry.chunk = m_chunks.extract(chunkPos);
     }
     
-    // Remove mesh data
-    auto meshIt = m_chunkMeshes.find(chunkPos);
-    if (meshIt != m_chunkMeshes.end()) {
-        m_chunkMeshes.erase(meshIt);
+    // Take the mesh data along
+    if (m_faceArena.contains(chunkPos)) {
+        if (!meshStale) {
+            entry.mesh = m_faceArena.getMesh(chunkPos);
+        }
+        m_faceArena.remove(chunkPos);
     }
     
-    // Clean up per-chunk mutex
-    removeChunkMutex(chunkPos);
+    // Park the section so walking back restores it, edits included
+    if (entry.chunk) {
+        entry.neighborMask = getLoadedNeighborMask(chunkPos);
+        m_chunkCache.put(chunkPos, std::move(entry));
+    }
 }
 
 void ChunkManager::generateTerrain(Chunk& chunk) {
     m_terrainGenerator->generateTerrain(chunk);
 }
 
-bool ChunkManager::isChunkInRange(const glm::ivec3& chunkPos, const glm::ivec3& centerChunkPos) const {
-    glm::ivec3 diff = chunkPos - centerChunkPos;
-    
-    // Check spherical distance for all dimensions
-    int distSquared = diff.x * diff.x + diff.y * diff.y + diff.z * diff.z;
-    if (distSquared > m_renderDistance * m_renderDistance) {
+ChunkLoadVolume ChunkManager::getMeshVolume() const {
+    ChunkLoadVolume volume;
+    volume.horizontalRadius = m_renderDistance;
+    volume.verticalRadius = m_verticalRenderDistance;
+    return volume;
+}
+
+ChunkLoadVolume ChunkManager::getLoadVolume() const {
+    ChunkLoadVolume volume = getMeshVolume();
+    volume.horizontalRadius += GENERATION_RING;
+    volume.verticalRadius += GENERATION_RING;
+    return volume;
+}
+
+ChunkLoadVolume ChunkManager::getUnloadVolume() const {
+    ChunkLoadVolume volume = getLoadVolume();
+    volume.horizontalRadius += UNLOAD_HYSTERESIS;
+    volume.verticalRadius += UNLOAD_HYSTERESIS;
+    return volume;
+}
+
+bool ChunkManager::restoreCachedChunk(const glm::ivec3& chunkPos) {
+    std::optional<ChunkCache::Entry> entry = m_chunkCache.take(chunkPos);
+    if (!entry) {
         return false;
     }
     
+    LOG_TRACE("Restoring cached chunk at (%d, %d, %d)", chunkPos.x, chunkPos.y, chunkPos.z);
+    
+    bool meshUsable = entry->mesh != nullptr;
+    {
+        std::unique_lock<std::shared_mutex> lock(m_chunksMutex);
+        Chunk* stored = m_chunks.insert(std::move(entry->chunk));
+        m_chunkOctree->addChunk(stored);
+        
+        // The cached mesh culled its border and computed AO against neighbors
+        // that were missing then
+        if (getLoadedNeighborMask(chunkPos) & ~entry->neighborMask) {
+            meshUsable = false;
+        }
+        
+        if (meshUsable) {
+            m_faceArena.update(chunkPos, std::move(entry->mesh));
+        }
+    }
+    setSectionPresent(chunkPos, true);
+    
+    // Without a usable mesh the section goes through the neighbor gate like a new one
+    if (meshUsable) {
+        m_chunkStates[chunkPos] = ChunkState::Meshed;
+        recordTimeToVisible(chunkPos);
+        m_needsRebuild = true;
+    } else {
+        m_chunkStates[chunkPos] = ChunkState::Generated;
+        m_generatedChunks.insert(chunkPos);
+    }
+    
+    // Neighbors may have been meshed while this section was missing
+    std::vector<glm::ivec3> neighborsToRemesh;
+    onSectionAdded(chunkPos, neighborsToRemesh);
+    for (const auto& neighborPos : neighborsToRemesh) {
+        queueMeshGeneration(neighborPos, computeChunkPriority(neighborPos) - NEIGHBOR_REMESH_PENALTY);
+    }
     return true;
 }
 
+uint32_t ChunkManager::getLoadedNeighborMask(const glm::ivec3& chunkPos) const {
+    uint32_t mask = 0;
+    int bit = 0;
+    for (int dz = -1; dz <= 1; ++dz) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx, ++bit) {
+                if ((dx | dy | dz) != 0 && m_chunks.contains(chunkPos + glm::ivec3(dx, dy, dz))) {
+                    mask |= 1u << bit;
+                }
+            }
+        }
+    }
+    return mask;
+}
+
+ChunkMeshSnapshot ChunkManager::makeMeshSnapshot(ChunkMesh&& mesh) {
+    mesh.generation = ++m_meshGeneration;
+    return std::make_shared<const ChunkMesh>(std::move(mesh));
+}
+
+void ChunkManager::setSectionPresent(const glm::ivec3& chunkPos, bool present) {
+    if (!ChunkColumn::isValidSection(chunkPos.y)) return;
+    
+    glm::ivec2 columnPos(chunkPos.x, chunkPos.z);
+    auto& column = m_columns[columnPos];
+    if (present) {
+        column.presentSections |= ChunkColumn::sectionBit(chunkPos.y);
+    } else {
+        column.presentSections &= ~ChunkColumn::sectionBit(chunkPos.y);
+    }
+    if (column.isEmpty()) {
+        m_columns.erase(columnPos);
+    }
+}
+
+void ChunkManager::setSectionLoading(const glm::ivec3& chunkPos, bool loading) {
+    if (!ChunkColumn::isValidSection(chunkPos.y)) return;
+    
+    glm::ivec2 columnPos(chunkPos.x, chunkPos.z);
+    auto& column = m_columns[columnPos];
+    if (loading) {
+        column.loadingSections |= ChunkColumn::sectionBit(chunkPos.y);
+    } else {
+        column.loadingSections &= ~ChunkColumn::sectionBit(chunkPos.y);
+    }
+    if (column.isEmpty()) {
+        m_columns.erase(columnPos);
+    }
+}
 
 void ChunkManager::loadChunkAsync(const glm::ivec3& chunkPos, int priority) {
-    // Calculate task priority based on distance
-    TaskPriority taskPriority = TaskPriority::Normal;
-    if (priority > 900) taskPriority = TaskPriority::Critical;
-    else if (priority > 700) taskPriority = TaskPriority::High;
-    else if (priority > 500) taskPriority = TaskPriority::Normal;
-    else if (priority > 300) taskPriority = TaskPriority::Low;
-    else taskPriority = TaskPriority::Idle;
+    // Bucket from the view-aware priority; the raw value orders tasks within the bucket
+    TaskPriority taskPriority = loadTaskPriority(priority);
     
     // Submit chunk loading task and get the real task ID
     auto [future, taskId] = g_threadPool->submitTaskWithId(
         [this, chunkPos]() -> int {
             auto chunkData = loadChunkBackground(chunkPos);
+            chunkData->taskId = ThreadPool::getCurrentTaskId();
             
-            // Add to completed chunks queue
+            // Add to completed chunks queue; tracking is released on the main thread
+            // so a newer task for the same section is never untracked by this one
             {
                 std::lock_guard<std::mutex> lock(m_completedMutex);
                 m_completedChunks.push({chunkPos, std::move(chunkData)});
             }
-            
-            // Remove from loading map
-            {
-                std::lock_guard<std::mutex> lock(m_loadingMutex);
-                m_loadingChunks.erase(chunkPos);
-            }
             return 0;
         },
         taskPriority,
-        "LoadChunk_" + std::to_string(chunkPos.x) + "_" + std::to_string(chunkPos.y) + "_" + std::to_string(chunkPos.z)
+        "LoadChunk_" + std::to_string(chunkPos.x) + "_" + std::to_string(chunkPos.y) + "_" + std::to_string(chunkPos.z),
+        priority
     );
     
     // Track the loading task with the real task ID
@@ -524,54 +875,58 @@ void ChunkManager::loadChunkAsync(const glm::ivec3& chunkPos, int priority) {
         std::lock_guard<std::mutex> lock(m_loadingMutex);
         m_loadingChunks[chunkPos] = taskId;
     }
+    setSectionLoading(chunkPos, true);
 }
 
 
-std::vector<BlockbenchInstanceGenerator::FaceInstance> ChunkManager::generateMeshForChunk(
-    const glm::ivec3& chunkPos, Chunk* chunk) {
+CompletedMesh ChunkManager::generateMeshForChunk(
+    const glm::ivec3& chunkPos, const ChunkMeshSnapshot& previous, const ChunkSliceMask& dirtySlices) {
     PROFILE_FUNCTION();
     
     auto start = std::chrono::high_resolution_clock::now();
     
-    if (!chunk) {
-        return {};
-    }
+    CompletedMesh result;
+    result.chunkPos = chunkPos;
     
-    // Get neighboring chunks for proper face culling
-    const Chunk* neighborXMinus = nullptr;
-    const Chunk* neighborXPlus = nullptr;
-    const Chunk* neighborYMinus = nullptr;
-    const Chunk* neighborYPlus = nullptr;
-    const Chunk* neighborZMinus = nullptr;
-    const Chunk* neighborZPlus = nullptr;
+    // Temporaries come from this worker's arena and are freed together on return;
+    // only the packed mesh is kept
+    ScratchArena::Scope scratch;
     
-    {
-        std::shared_lock<std::shared_mutex> lock(m_chunksMutex);
-        
-        auto neighborIt = m_chunks.find(chunkPos + glm::ivec3(-1, 0, 0));
-        if (neighborIt != m_chunks.end()) neighborXMinus = neighborIt->second.get();
-        
-        neighborIt = m_chunks.find(chunkPos + glm::ivec3(1, 0, 0));
-        if (neighborIt != m_chunks.end()) neighborXPlus = neighborIt->second.get();
-        
-        neighborIt = m_chunks.find(chunkPos + glm::ivec3(0, -1, 0));
-        if (neighborIt != m_chunks.end()) neighborYMinus = neighborIt->second.get();
-        
-        neighborIt = m_chunks.find(chunkPos + glm::ivec3(0, 1, 0));
-        if (neighborIt != m_chunks.end()) neighborYPlus = neighborIt->second.get();
-        
-        neighborIt = m_chunks.find(chunkPos + glm::ivec3(0, 0, -1));
-        if (neighborIt != m_chunks.end()) neighborZMinus = neighborIt->second.get();
-        
-        neighborIt = m_chunks.find(chunkPos + glm::ivec3(0, 0, 1));
-        if (neighborIt != m_chunks.end()) neighborZPlus = neighborIt->second.get();
+    // Snapshot the chunk and its 1-block neighbor border
+    auto extendedData = createExtendedChunkData(chunkPos);
+    if (!extendedData) {
+        return result;
     }
     
-    // Create 18x18x18 block data by sampling from loaded chunks
-    auto extendedBlockData = createExtendedBlockData(chunkPos);
+    // Neighbor arrivals and block edits often leave everything the mesh depends on
+    // as it was (a border matching the mirrored shell, stone replaced by stone
+    // underground); culling is cheap next to meshing, so hash its result first
+    const OccupancyMasks occupancy(*extendedData);
+    const FaceVisibilityMask visibilityMask = FaceVisibilityMaskGenerator::generateMask(*extendedData, occupancy);
+    const uint64_t inputHash = m_meshGenerator->computeMeshInputHash(*extendedData, occupancy, visibilityMask);
+    result.hashChecked = previous && previous->inputHash != 0;
+    if (result.hashChecked && inputHash == previous->inputHash) {
+        result.unchanged = true;
+        return result;
+    }
+    
+    // Block edits only touch the slices around them; rebuild those and keep the rest
+    std::optional<ChunkMesh> incremental;
+    if (previous && dirtySlices != ALL_CHUNK_SLICES) {
+        incremental = m_meshGenerator->generateChunkMeshIncremental(*extendedData, occupancy, visibilityMask,
+                                                                    *previous, dirtySlices);
+    }
     
     // Generate mesh with extended 18x18x18 data to prevent border artifacts
-    auto result = m_meshGenerator->generateChunkMeshExtended(*chunk, extendedBlockData);
+    result.incremental = incremental.has_value();
+    result.mesh = incremental ? std::move(*incremental)
+        : m_meshGenerator->generateChunkMeshExtended(*extendedData, occupancy, visibilityMask, scratch.resource())
+              .pack(chunkPos * Chunk::CHUNK_SIZE);
+    
+    // A spliced mesh copies its clean slices from previous, which may predate changes
+    // the snapshot already holds (an edit landing after this task was queued); only a
+    // full mesh is known to match the hash
+    result.mesh.inputHash = incremental ? 0 : inputHash;
     
     auto end = std::chrono::high_resolution_clock::now();
     float duration = std::chrono::duration<float, std::milli>(end - start).count();
@@ -611,6 +966,9 @@ std::unique_ptr<ChunkData> ChunkManager::loadChunkBackground(const glm::ivec3& c
 }
 
 void ChunkManager::processCompletedChunks() {
+    // Free chunks unloaded or replaced in earlier frames once no reader holds them
+    EpochReclaimer::get().collect();
+    
     // Process completed chunk loads (terrain generation)
     {
         std::lock_guard<std::mutex> completedLock(m_completedMutex);
@@ -622,21 +980,35 @@ void ChunkManager::processCompletedChunks() {
             auto [chunkPos, chunkData] = std::move(m_completedChunks.front());
             m_completedChunks.pop();
             
-            // Check if this chunk position is still needed (not unloaded while loading)
+            // Cancelled after it started, or superseded by a newer load: the section
+            // was already untracked, so the result is simply dropped
+            if (!releaseTrackedTask(m_loadingChunks, m_loadingMutex, chunkPos, chunkData->taskId)) {
+                m_taskStats.wastedGenerations++;
+                continue;
+            }
+            
+            // The section is no longer in flight, whether or not it is kept
+            setSectionLoading(chunkPos, false);
+            
+            // Check if this chunk position is still needed (not unloaded while loading).
+            // Sections inside the unload hysteresis are kept like loaded ones
+            const bool inRange = getUnloadVolume().contains(m_lastPlayerChunkPos, chunkPos);
             bool shouldProcess = false;
             {
                 std::shared_lock<std::shared_mutex> readLock(m_chunksMutex);
                 // Only process if chunk isn't already loaded and is still within render distance
-                if (m_chunks.find(chunkPos) == m_chunks.end()) {
-                    glm::ivec3 diff = chunkPos - m_lastPlayerChunkPos;
-                    int distSquared = diff.x * diff.x + diff.y * diff.y + diff.z * diff.z;
-                    shouldProcess = (distSquared <= m_renderDistance * m_renderDistance);
+                if (!m_chunks.contains(chunkPos)) {
+                    shouldProcess = inRange;
                 }
             }
             
             if (!shouldProcess) {
+                if (!inRange) {
+                    m_loadRequestTimes.erase(chunkPos);
+                }
                 LOG_TRACE("Discarding completed chunk at (%d, %d, %d) - no longer needed", 
                          chunkPos.x, chunkPos.y, chunkPos.z);
+                m_taskStats.wastedGenerations++;
                 continue;
             }
             
@@ -644,39 +1016,29 @@ void ChunkManager::processCompletedChunks() {
             {
                 std::unique_lock<std::shared_mutex> chunksLock(m_chunksMutex);
                 // Double-check under write lock
-                if (m_chunks.find(chunkPos) != m_chunks.end()) {
+                if (m_chunks.contains(chunkPos)) {
+                    m_taskStats.wastedGenerations++;
                     continue; // Already loaded by another thread
                 }
                 
-                m_chunks[chunkPos] = std::move(chunkData->chunk);
+                Chunk* stored = m_chunks.insert(std::move(chunkData->chunk));
                 
                 // Add the chunk to the octree for spatial queries
-                m_chunkOctree->addChunk(m_chunks[chunkPos].get());
-                
-                // Check which neighboring chunks exist and need regeneration
-                glm::ivec3 neighbors[6] = {
-                    chunkPos + glm::ivec3(-1, 0, 0),
-                    chunkPos + glm::ivec3(1, 0, 0),
-                    chunkPos + glm::ivec3(0, -1, 0),
-                    chunkPos + glm::ivec3(0, 1, 0),
-                    chunkPos + glm::ivec3(0, 0, -1),
-                    chunkPos + glm::ivec3(0, 0, 1)
-                };
-                
-                for (const auto& neighborPos : neighbors) {
-                    if (m_chunks.find(neighborPos) != m_chunks.end()) {
-                        chunksToRegenerate.push_back(neighborPos);
-                    }
-                }
+                m_chunkOctree->addChunk(stored);
+                setSectionPresent(chunkPos, true);
             }
             
-            // Queue for mesh generation with high priority
-            queueMeshGeneration(chunkPos, 1000);
+            // Meshed once its neighbors are in, which may be right away; this section
+            // may also be the last neighbor others were waiting for
+            m_chunkStates[chunkPos] = ChunkState::Generated;
+            m_generatedChunks.insert(chunkPos);
+            onSectionAdded(chunkPos, chunksToRegenerate);
         }
         
-        // Queue neighbor chunks for mesh regeneration
+        // Neighbors meshed without this section (it entered range after them) are
+        // remeshed behind first meshes at similar distance
         for (const auto& chunkPos : chunksToRegenerate) {
-            queueMeshGeneration(chunkPos, 500);
+            queueMeshGeneration(chunkPos, computeChunkPriority(chunkPos) - NEIGHBOR_REMESH_PENALTY);
         }
     }
     
@@ -691,17 +1053,46 @@ void ChunkManager::processCompletedChunks() {
             auto completedMesh = std::move(m_completedMeshes.front());
             m_completedMeshes.pop();
             
+            if (completedMesh.taskId != 0 &&
+                !releaseTrackedTask(m_meshingChunks, m_meshingMutex, completedMesh.chunkPos, completedMesh.taskId)) {
+                m_taskStats.wastedMeshes++; // Cancelled after it started
+                continue;
+            }
+            
             // Check if chunk still exists before updating mesh
             {
                 std::unique_lock<std::shared_mutex> chunksLock(m_chunksMutex);
-                auto chunkIt = m_chunks.find(completedMesh.chunkPos);
-                if (chunkIt != m_chunks.end()) {
-                    // Chunk still exists, update its mesh
-                    m_chunkMeshes[completedMesh.chunkPos] = std::move(completedMesh.faces);
-                    meshesUpdated = true;
+                if (m_chunks.contains(completedMesh.chunkPos)) {
+                    if (completedMesh.hashChecked) {
+                        m_taskStats.meshHashChecks++;
+                    }
+                    if (completedMesh.editTime) {
+                        recordEditLatency(*completedMesh.editTime);
+                    }
+                    if (completedMesh.unchanged) {
+                        m_taskStats.meshHashHits++; // The integrated mesh is still current
+                    } else {
+                        // Chunk still exists, update its mesh
+                        m_faceArena.update(completedMesh.chunkPos, makeMeshSnapshot(std::move(completedMesh.mesh)));
+                        recordTimeToVisible(completedMesh.chunkPos);
+                        meshesUpdated = true;
+                        
+                        if (completedMesh.taskId != 0) {
+                            m_taskStats.meshesBuilt++;
+                        }
+                        if (completedMesh.incremental) {
+                            m_taskStats.incrementalRemeshes++;
+                        }
+                    }
+                    auto state = m_chunkStates.find(completedMesh.chunkPos);
+                    if (state != m_chunkStates.end() && state->second != ChunkState::Meshed) {
+                        state->second = ChunkState::Meshed;
+                        m_taskStats.chunksMeshed++;
+                    }
                 } else {
                     LOG_TRACE("Discarding completed mesh for chunk at (%d, %d, %d) - chunk was unloaded", 
                              completedMesh.chunkPos.x, completedMesh.chunkPos.y, completedMesh.chunkPos.z);
+                    m_taskStats.wastedMeshes++;
                 }
             }
         }
@@ -709,78 +1100,199 @@ void ChunkManager::processCompletedChunks() {
         // Rebuild if needed
         if (meshesUpdated) {
             m_needsRebuild = true;
-            rebuildAllFaceInstances();
+            rebuildIndirectCommands();
         }
     }
 }
 
-void ChunkManager::regenerateChunkMesh(const glm::ivec3& chunkPos) {
-    // Check if chunk exists and queue it for mesh generation
-    {
-        std::shared_lock<std::shared_mutex> lock(m_chunksMutex);
-        if (m_chunks.find(chunkPos) == m_chunks.end()) {
-            return;
+void ChunkManager::regenerateChunkMesh(const glm::ivec3& chunkPos, const ChunkSliceMask& slices,
+                                       std::optional<std::chrono::steady_clock::time_point> editTime) {
+    m_taskStats.remeshRequests++;
+    m_dirtyChunks[chunkPos].merge(slices, editTime);
+}
+
+void ChunkManager::flushDirtyChunks() {
+    for (auto it = m_dirtyChunks.begin(); it != m_dirtyChunks.end();) {
+        const auto [chunkPos, dirty] = *it;
+        
+        // Sections still waiting for their first mesh pick up the change when they get it
+        auto state = m_chunkStates.find(chunkPos);
+        if (state == m_chunkStates.end() || state->second == ChunkState::Generated) {
+            // A cached section would restore a mesh built before the change
+            if (state == m_chunkStates.end()) {
+                m_chunkCache.dropMesh(chunkPos);
+            }
+            it = m_dirtyChunks.erase(it);
+            continue;
+        }
+        
+        bool meshing;
+        {
+            std::lock_guard<std::mutex> lock(m_meshingMutex);
+            meshing = m_meshingChunks.contains(chunkPos);
+        }
+        if (meshing) {
+            ++it;
+            continue;
         }
+        
+        it = m_dirtyChunks.erase(it);
+        queueMeshGeneration(chunkPos, computeChunkPriority(chunkPos), dirty.slices, dirty.editTime);
+        m_taskStats.remeshesFlushed++;
     }
+}
+
+void ChunkManager::recordEditLatency(std::chrono::steady_clock::time_point editTime) {
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - editTime).count();
     
-    queueMeshGeneration(chunkPos, 500);
+    bool streaming = !m_pendingLoads.empty();
+    if (!streaming) {
+        std::lock_guard<std::mutex> lock(m_loadingMutex);
+        streaming = !m_loadingChunks.empty();
+    }
+    (streaming ? m_editLatencyStats.streaming : m_editLatencyStats.idle).record(ms);
 }
 
-void ChunkManager::queueMeshGeneration(const glm::ivec3& chunkPos, int priority) {
-    // Check if already meshing
-    {
-        std::lock_guard<std::mutex> lock(m_meshingMutex);
-        if (m_meshingChunks.find(chunkPos) != m_meshingChunks.end()) {
-            return;
+bool ChunkManager::hasNeighborsForMeshing(const glm::ivec3& chunkPos) const {
+    // The load volume already excludes sections above and below the world
+    const ChunkLoadVolume volume = getLoadVolume();
+    for (int dz = -1; dz <= 1; ++dz) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                const glm::ivec3 neighborPos = chunkPos + glm::ivec3(dx, dy, dz);
+                if (neighborPos == chunkPos || !volume.contains(m_lastPlayerChunkPos, neighborPos)) {
+                    continue;
+                }
+                if (!m_chunks.contains(neighborPos)) {
+                    return false;
+                }
+            }
         }
     }
+    return true;
+}
+
+void ChunkManager::scheduleFirstMesh(const glm::ivec3& chunkPos) {
+    auto state = m_chunkStates.find(chunkPos);
+    if (state == m_chunkStates.end() || state->second != ChunkState::Generated) {
+        return;
+    }
+    if (!getMeshVolume().contains(m_lastPlayerChunkPos, chunkPos) || !hasNeighborsForMeshing(chunkPos)) {
+        return;
+    }
     
-    // Calculate task priority based on distance
-    TaskPriority taskPriority = TaskPriority::Normal;
-    if (priority > 900) taskPriority = TaskPriority::High;
-    else if (priority > 700) taskPriority = TaskPriority::Normal;
-    else if (priority > 500) taskPriority = TaskPriority::Low;
-    else taskPriority = TaskPriority::Idle;
+    state->second = ChunkState::NeighborsReady;
+    m_generatedChunks.erase(chunkPos);
     
-    // Submit mesh generation task and get the real task ID
-    auto [future, taskId] = g_threadPool->submitTaskWithId(
-        [this, chunkPos]() -> int {
-            // Get the chunk to generate mesh for
-            Chunk* chunk = nullptr;
-            {
-                std::shared_lock<std::shared_mutex> lock(m_chunksMutex);
-                auto it = m_chunks.find(chunkPos);
-                if (it == m_chunks.end()) {
-                    // Chunk was unloaded, remove from meshing map and return
-                    std::lock_guard<std::mutex> meshLock(m_meshingMutex);
-                    m_meshingChunks.erase(chunkPos);
-                    return 0;
+    // Queue for mesh generation, sooner for chunks in view
+    queueMeshGeneration(chunkPos, computeChunkPriority(chunkPos));
+}
+
+void ChunkManager::onSectionAdded(const glm::ivec3& chunkPos, std::vector<glm::ivec3>& neighborsToRemesh) {
+    scheduleFirstMesh(chunkPos);
+    
+    for (int dz = -1; dz <= 1; ++dz) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                const glm::ivec3 neighborPos = chunkPos + glm::ivec3(dx, dy, dz);
+                auto state = m_chunkStates.find(neighborPos);
+                if (neighborPos == chunkPos || state == m_chunkStates.end()) {
+                    continue;
+                }
+                if (state->second == ChunkState::Generated) {
+                    scheduleFirstMesh(neighborPos);
+                } else {
+                    neighborsToRemesh.push_back(neighborPos);
                 }
-                chunk = it->second.get();
-            }
-            
-            // Generate mesh
-            auto faces = generateMeshForChunk(chunkPos, chunk);
-            
-            // Add to completed meshes queue
-            {
-                std::lock_guard<std::mutex> lock(m_completedMeshMutex);
-                CompletedMesh completedMesh;
-                completedMesh.chunkPos = chunkPos;
-                completedMesh.faces = std::move(faces);
-                m_completedMeshes.push(std::move(completedMesh));
             }
-            
-            // Remove from meshing map
-            {
-                std::lock_guard<std::mutex> lock(m_meshingMutex);
-                m_meshingChunks.erase(chunkPos);
+        }
+    }
+}
+
+void ChunkManager::queueMeshGeneration(const glm::ivec3& chunkPos, int priority, const ChunkSliceMask& dirtySlices,
+                                       std::optional<std::chrono::steady_clock::time_point> editTime) {
+    // Check if already meshing; the running task may have read the chunk before the
+    // change that prompted this request, so remesh once it lands
+    bool meshing;
+    {
+        std::lock_guard<std::mutex> lock(m_meshingMutex);
+        meshing = m_meshingChunks.contains(chunkPos);
+    }
+    if (meshing) {
+        m_dirtyChunks[chunkPos].merge(dirtySlices, editTime);
+        return;
+    }
+    
+    // Uniform chunks surrounded by the same block produce no faces - skip the job entirely
+    bool skipMeshing = false;
+    bool hasStaleMesh = false;
+    ChunkMeshSnapshot previous;
+    {
+        std::shared_lock<std::shared_mutex> lock(m_chunksMutex);
+        if (canSkipMeshing(chunkPos)) {
+            skipMeshing = true;
+            hasStaleMesh = !m_faceArena.getFaces(chunkPos).empty();
+        } else {
+            // No other mesh task is in flight, so this is the newest mesh of the section
+            previous = m_faceArena.getMesh(chunkPos);
+        }
+    }
+    
+    if (skipMeshing) {
+        m_skippedUniformMeshes++;
+        m_loadRequestTimes.erase(chunkPos); // Nothing to show, so no time-to-visible sample
+        auto state = m_chunkStates.find(chunkPos);
+        if (state != m_chunkStates.end()) {
+            state->second = ChunkState::Meshed;
+        }
+        if (hasStaleMesh) {
+            // Clear the previous mesh through the normal integration path
+            std::lock_guard<std::mutex> lock(m_completedMeshMutex);
+            CompletedMesh completedMesh;
+            completedMesh.chunkPos = chunkPos;
+            completedMesh.editTime = editTime;
+            m_completedMeshes.push(std::move(completedMesh));
+        } else if (editTime) {
+            recordEditLatency(*editTime); // Nothing was drawn before or after the edit
+        }
+        return;
+    }
+    
+    auto meshTask = [this, chunkPos, previous = std::move(previous), dirtySlices, editTime]() -> int {
+        // Make sure the chunk is still loaded; unloading already untracked this task
+        {
+            EpochReclaimer::Guard guard;
+            if (!m_chunks.contains(chunkPos)) {
+                return 0;
             }
-            return 0;
-        },
-        taskPriority,
-        "MeshGen_" + std::to_string(chunkPos.x) + "_" + std::to_string(chunkPos.y) + "_" + std::to_string(chunkPos.z)
-    );
+        }
+        
+        // Generate mesh, unless its input matches the current one
+        CompletedMesh completedMesh = generateMeshForChunk(chunkPos, previous, dirtySlices);
+        completedMesh.taskId = ThreadPool::getCurrentTaskId();
+        completedMesh.editTime = editTime;
+        
+        // Add to completed meshes queue
+        {
+            std::lock_guard<std::mutex> lock(m_completedMeshMutex);
+            m_completedMeshes.push(std::move(completedMesh));
+        }
+        return 0;
+    };
+    
+    const std::string taskName =
+        "MeshGen_" + std::to_string(chunkPos.x) + "_" + std::to_string(chunkPos.y) + "_" + std::to_string(chunkPos.z);
+    
+    // The player is waiting on their own edits, so those skip the terrain streaming
+    // backlog. Otherwise bucket from the view-aware priority; the raw value orders
+    // tasks within the bucket
+    Task::TaskId taskId;
+    if (editTime) {
+        taskId = g_threadPool->submitInteractiveTaskWithId(std::move(meshTask), taskName).second;
+    } else {
+        taskId = g_threadPool->submitTaskWithId(std::move(meshTask), meshTaskPriority(priority), taskName,
+                                                priority).second;
+    }
     
     // Track the meshing task with the real task ID
     {
@@ -789,6 +1301,49 @@ void ChunkManager::queueMeshGeneration(const glm::ivec3& chunkPos, int priority)
     }
 }
 
+bool ChunkManager::canSkipMeshing(const glm::ivec3& chunkPos) const {
+    const Chunk* chunk = m_chunks.find(chunkPos);
+    if (!chunk || !chunk->isUniform()) {
+        return false;
+    }
+    
+    BlockType type = chunk->getUniformBlock();
+    if (type == Blocks::AIR) {
+        return true; // Air never emits faces
+    }
+    
+    // Only blocks that cull faces against their own type can be skipped
+    const auto& props = BlockProperties::getCullingProperties(type);
+    if (!props.isTransparent) {
+        if (!props.canBeCulled || type == Blocks::OAK_STAIRS) {
+            return false;
+        }
+        for (CullFace cull : props.faceCulling) {
+            if (cull != CullFace::FULL) {
+                return false;
+            }
+        }
+    }
+    
+    static const glm::ivec3 faceOffsets[6] = {
+        glm::ivec3(-1, 0, 0), glm::ivec3(1, 0, 0),
+        glm::ivec3(0, -1, 0), glm::ivec3(0, 1, 0),
+        glm::ivec3(0, 0, -1), glm::ivec3(0, 0, 1)
+    };
+    
+    for (const auto& offset : faceOffsets) {
+        const Chunk* neighbor = m_chunks.find(chunkPos + offset);
+        if (!neighbor) {
+            continue; // Unloaded neighbors mirror this chunk's border (see ChunkNeighborhood)
+        }
+        if (!neighbor->isUniform() || neighbor->getUniformBlock() != type) {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
 std::vector<Chunk*> ChunkManager::getChunksInRegion(const AABB& region) const {
     std::shared_lock<std::shared_mutex> lock(m_chunksMutex);
     return m_chunkOctree->getChunksInRegion(region);
@@ -801,50 +1356,35 @@ std::vector<Chunk*> ChunkManager::getChunksAlongRay(const glm::vec3& origin,
     return m_chunkOctree->getChunksAlongRay(origin, direction, maxDistance);
 }
 
-std::array<BlockType, 18*18*18> ChunkManager::createExtendedBlockData(const glm::ivec3& chunkPos) {
-    std::array<BlockType, 18*18*18> extendedData;
-    
-    // Get the chunk and return its extended data directly
-    std::shared_lock<std::shared_mutex> lock(m_chunksMutex);
-    auto it = m_chunks.find(chunkPos);
-    if (it == m_chunks.end()) {
-        // Chunk not loaded, return all AIR
-        std::fill(extendedData.begin(), extendedData.end(), Blocks::AIR);
-        return extendedData;
-    }
-    
-    // Copy the chunk's extended block data
-    const auto& chunk = *it->second;
-    for (int x = -1; x <= 16; ++x) {
-        for (int y = -1; y <= 16; ++y) {
-            for (int z = -1; z <= 16; ++z) {
-                int ex = x + 1;  // Convert -1..16 to 0..17
-                int ey = y + 1;
-                int ez = z + 1;
-                int index = ex + ey * 18 + ez * 18 * 18;
-                extendedData[index] = chunk.getExtendedBlock(x, y, z);
+ChunkNeighborhood ChunkManager::getChunkNeighborhood(const Chunk& chunk) const {
+    ChunkNeighborhood neighborhood(chunk);
+    const glm::ivec3 chunkPos = chunk.getChunkPosition();
+    
+    for (int dz = -1; dz <= 1; ++dz) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                glm::ivec3 offset(dx, dy, dz);
+                if (offset == glm::ivec3(0)) continue;
+                
+                neighborhood.setNeighbor(offset, m_chunks.find(chunkPos + offset));
             }
         }
     }
     
-    return extendedData;
+    return neighborhood;
 }
 
-std::shared_ptr<std::mutex> ChunkManager::getChunkMutex(const glm::ivec3& chunkPos) const {
-    std::lock_guard<std::mutex> lock(m_chunkMutexesMutex);
-    auto it = m_chunkMutexes.find(chunkPos);
-    if (it != m_chunkMutexes.end()) {
-        return it->second;
+std::optional<ExtendedChunkData> ChunkManager::createExtendedChunkData(const glm::ivec3& chunkPos) const {
+    // Published chunks are immutable, so pinning the epoch is enough to keep
+    // the chunk and its neighbors alive while copying
+    EpochReclaimer::Guard guard;
+    const Chunk* chunk = m_chunks.find(chunkPos);
+    if (!chunk) {
+        return std::nullopt;
     }
     
-    auto chunkMutex = std::make_shared<std::mutex>();
-    m_chunkMutexes[chunkPos] = chunkMutex;
-    return chunkMutex;
-}
-
-void ChunkManager::removeChunkMutex(const glm::ivec3& chunkPos) {
-    std::lock_guard<std::mutex> lock(m_chunkMutexesMutex);
-    m_chunkMutexes.erase(chunkPos);
+    // Built in place, the snapshot is too large to copy around
+    return std::optional<ExtendedChunkData>(std::in_place, getChunkNeighborhood(*chunk));
 }
 
 } // namespace Zerith
\ No newline at end of file
@@ -0,0 +1,42 @@
+#include "chunk_neighborhood.h"
+#include <algorithm>
+
+namespace Zerith {
+
+ChunkNeighborhood::ChunkNeighborhood(const Chunk& center)
+    : m_center(&center) {
+    m_neighbors[getNeighborIndex(0, 0, 0)] = m_center;
+}
+
+void ChunkNeighborhood::setNeighbor(const glm::ivec3& offset, const Chunk* neighbor) {
+    if (offset == glm::ivec3(0)) {
+        return; // The center chunk is fixed at construction
+    }
+    m_neighbors[getNeighborIndex(offset.x, offset.y, offset.z)] = neighbor;
+}
+
+BlockType ChunkNeighborhood::getBlock(int x, int y, int z) const {
+    constexpr int SIZE = Chunk::CHUNK_SIZE;
+
+    // Fast path: inside the center chunk
+    if (x >= 0 && x < SIZE && y >= 0 && y < SIZE && z >= 0 && z < SIZE) {
+        return m_center->getBlock(x, y, z);
+    }
+
+    int dx = x < 0 ? -1 : (x >= SIZE ? 1 : 0);
+    int dy = y < 0 ? -1 : (y >= SIZE ? 1 : 0);
+    int dz = z < 0 ? -1 : (z >= SIZE ? 1 : 0);
+
+    const Chunk* owner = m_neighbors[getNeighborIndex(dx, dy, dz)];
+    if (!owner) {
+        // Neighbor not loaded - mirror the nearest center block
+        return m_center->getBlock(std::clamp(x, 0, SIZE - 1),
+                                  std::clamp(y, 0, SIZE - 1),
+                                  std::clamp(z, 0, SIZE - 1));
+    }
+
+    // Wrap into the neighbor's local coordinates (-1 -> 15, 16 -> 0)
+    return owner->getBlock(x & (SIZE - 1), y & (SIZE - 1), z & (SIZE - 1));
+}
+
+} // namespace Zerith
@@ -5,10 +5,18 @@
 
 namespace Zerith {
 
-ExtendedChunkData::ExtendedChunkData(const std::array<BlockType, EXTENDED_VOLUME>& blockData, 
-                                     const glm::ivec3& chunkPos)
-    : m_blocks(blockData), m_chunkPosition(chunkPos) {
-    // Data is already complete - nothing to do
+ExtendedChunkData::ExtendedChunkData(const ChunkNeighborhood& neighborhood)
+    : m_chunkPosition(neighborhood.getChunkPosition()) {
+    for (int z = -BORDER_SIZE; z <= Chunk::CHUNK_SIZE; ++z) {
+        for (int y = -BORDER_SIZE; y <= Chunk::CHUNK_SIZE; ++y) {
+            for (int x = -BORDER_SIZE; x <= Chunk::CHUNK_SIZE; ++x) {
+                m_blocks[getExtendedIndex(x, y, z)] = neighborhood.getBlock(x, y, z);
+            }
+        }
+    }
+    
+    // The chunk keeps block counts, so emptiness doesn't need another scan
+    m_centerSolidBlocks = Chunk::CHUNK_VOLUME - neighborhood.getCenter().getBlockCount(Blocks::AIR);
 }
 
 BlockType ExtendedChunkData::getBlock(int x, int y, int z) const {
@@ -18,6 +26,21 @@ BlockType ExtendedChunkData::getBlock(int x, int y, int z) const {
     return m_blocks[getExtendedIndex(x, y, z)];
 }
 
+void ExtendedChunkData::setBlock(int x, int y, int z, BlockType type) {
+    if (!isInExtendedBounds(x, y, z)) {
+        return;
+    }
+    
+    BlockType& block = m_blocks[getExtendedIndex(x, y, z)];
+    const bool inCenter = x >= 0 && x < Chunk::CHUNK_SIZE &&
+                          y >= 0 && y < Chunk::CHUNK_SIZE &&
+                          z >= 0 && z < Chunk::CHUNK_SIZE;
+    if (inCenter) {
+        m_centerSolidBlocks += (type != Blocks::AIR) - (block != Blocks::AIR);
+    }
+    block = type;
+}
+
 bool ExtendedChunkData::isFaceVisible(int x, int y, int z, int dx, int dy, int dz) const {
     // Check if current block is not air
     BlockType currentBlock = getBlock(x, y, z);
@@ -0,0 +1,69 @@
+#include "occupancy_masks.h"
+#include "block_properties.h"
+#include "blocks.h"
+#include "voxel_ao.h"
+#include <bit>
+
+namespace Zerith {
+
+namespace {
+
+// Category membership of a block type, one bit per OccupancyMasks::Category
+uint32_t categorize(BlockType type) {
+    if (type == Blocks::AIR) {
+        return 0;
+    }
+
+    const uint32_t aoBits = VoxelAO::isBlockOccluding(type) ? 1u << OccupancyMasks::AO_OCCLUDER : 0u;
+    const auto& props = BlockProperties::getCullingProperties(type);
+    if (props.isTransparent) {
+        uint32_t bits = aoBits | 1u << OccupancyMasks::TRANSPARENT;
+        if (type == Blocks::WATER) {
+            bits |= 1u << OccupancyMasks::FLUID;
+        }
+        return bits;
+    }
+
+    uint32_t bits = aoBits | 1u << OccupancyMasks::OPAQUE;
+    // Stairs neither cull nor get culled (matches ExtendedChunkData::isFaceVisible)
+    if (type == Blocks::OAK_STAIRS) {
+        return bits;
+    }
+    if (props.canBeCulled) {
+        bits |= 1u << OccupancyMasks::CULLABLE;
+    }
+    for (int face = 0; face < 6; ++face) {
+        if (props.faceCulling[face] == CullFace::FULL) {
+            bits |= 1u << OccupancyMasks::fullFace(face);
+        }
+    }
+    return bits;
+}
+
+} // namespace
+
+OccupancyMasks::OccupancyMasks(const ExtendedChunkData& extendedData) {
+    // Terrain comes in long runs of one block type, so only re-categorize on change
+    BlockType lastType = Blocks::AIR;
+    uint32_t lastBits = 0;
+
+    for (int z = -ExtendedChunkData::BORDER_SIZE; z <= Chunk::CHUNK_SIZE; ++z) {
+        for (int y = -ExtendedChunkData::BORDER_SIZE; y <= Chunk::CHUNK_SIZE; ++y) {
+            const int row = getRowIndex(y, z);
+            for (int x = -ExtendedChunkData::BORDER_SIZE; x <= Chunk::CHUNK_SIZE; ++x) {
+                BlockType type = extendedData.getBlock(x, y, z);
+                if (type != lastType) {
+                    lastType = type;
+                    lastBits = categorize(type);
+                }
+
+                const uint32_t bit = 1u << (x + ExtendedChunkData::BORDER_SIZE);
+                for (uint32_t bits = lastBits; bits != 0; bits &= bits - 1) {
+                    m_rows[std::countr_zero(bits)][row] |= bit;
+                }
+            }
+        }
+    }
+}
+
+} // namespace Zerith
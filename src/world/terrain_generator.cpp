@@ -4,6 +4,7 @@
 #include "world_constants.h"
 #include "profiler.h"
 #include <cmath>
+#include <algorithm>
 
 namespace Zerith {
 
@@ -34,14 +35,22 @@ void TerrainGenerator::generateTerrain(Chunk& chunk) {
     
     // Pre-calculate terrain heights for this chunk
     int terrainHeights[Chunk::CHUNK_SIZE][Chunk::CHUNK_SIZE];
+    int maxTerrainHeight = WORLD_MIN_Y;
     for (int z = 0; z < Chunk::CHUNK_SIZE; ++z) {
         for (int x = 0; x < Chunk::CHUNK_SIZE; ++x) {
             int worldX = worldChunkStart.x + x;
             int worldZ = worldChunkStart.z + z;
             terrainHeights[x][z] = getTerrainHeight(worldX, worldZ);
+            maxTerrainHeight = std::max(maxTerrainHeight, terrainHeights[x][z]);
         }
     }
     
+    // Chunks entirely above the surface and sea level are pure air - leave them uniform
+    if (worldChunkStart.y > std::max(maxTerrainHeight, m_seaLevel)) {
+        chunk.fill(Blocks::AIR);
+        return;
+    }
+    
     // Generate blocks for standard 16x16x16 area
     for (int y = 0; y < Chunk::CHUNK_SIZE; ++y) {
         for (int z = 0; z < Chunk::CHUNK_SIZE; ++z) {
@@ -56,20 +65,8 @@ void TerrainGenerator::generateTerrain(Chunk& chunk) {
         }
     }
     
-    // Generate extended blocks for 18x18x18 area (includes overlapping border data)
-    for (int y = -1; y <= 16; ++y) {
-        for (int z = -1; z <= 16; ++z) {
-            for (int x = -1; x <= 16; ++x) {
-                int worldX = worldChunkStart.x + x;
-                int worldY = worldChunkStart.y + y;
-                int worldZ = worldChunkStart.z + z;
-                
-                int terrainHeight = getTerrainHeight(worldX, worldZ);
-                BlockType blockType = getBlockTypeForPosition(worldX, worldY, worldZ, terrainHeight);
-                chunk.setExtendedBlock(x, y, z, blockType);
-            }
-        }
-    }
+    // Collapse all-stone / all-water chunks back to uniform mode and trim index width
+    chunk.optimizeStorage();
 }
 
 int TerrainGenerator::getTerrainHeight(int worldX, int worldZ) {